@@ -1,13 +1,17 @@
 #ifndef ASPEN_HPP
 #define ASPEN_HPP
+#include "Aspen/BatchQueue.hpp"
 #include "Aspen/Box.hpp"
 #include "Aspen/Branch.hpp"
 #include "Aspen/Cell.hpp"
 #include "Aspen/Chain.hpp"
 #include "Aspen/CommitFlag.hpp"
 #include "Aspen/CommitHandler.hpp"
+#include "Aspen/CommitPool.hpp"
+#include "Aspen/CompiledGraph.hpp"
 #include "Aspen/Concat.hpp"
 #include "Aspen/Concur.hpp"
+#include "Aspen/ConflatingQueue.hpp"
 #include "Aspen/Constant.hpp"
 #include "Aspen/Conversions.hpp"
 #include "Aspen/Count.hpp"
@@ -16,10 +20,13 @@
 #include "Aspen/Executor.hpp"
 #include "Aspen/First.hpp"
 #include "Aspen/Fold.hpp"
+#include "Aspen/GraphArena.hpp"
 #include "Aspen/Group.hpp"
 #include "Aspen/Last.hpp"
 #include "Aspen/Lift.hpp"
 #include "Aspen/LocalPtr.hpp"
+#include "Aspen/LockFreeCell.hpp"
+#include "Aspen/LockFreeQueue.hpp"
 #include "Aspen/Maybe.hpp"
 #include "Aspen/MultiSync.hpp"
 #include "Aspen/None.hpp"
@@ -27,18 +34,23 @@
 #include "Aspen/Override.hpp"
 #include "Aspen/Perpetual.hpp"
 #include "Aspen/Previous.hpp"
+#include "Aspen/Profiler.hpp"
 #include "Aspen/Proxy.hpp"
 #include "Aspen/Queue.hpp"
 #include "Aspen/Range.hpp"
 #include "Aspen/Reactor.hpp"
 #include "Aspen/Shared.hpp"
+#include "Aspen/SlotLayout.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/StateReactor.hpp"
 #include "Aspen/StaticCommitHandler.hpp"
 #include "Aspen/Switch.hpp"
 #include "Aspen/Sync.hpp"
+#include "Aspen/Task.hpp"
+#include "Aspen/ThreadPoolExecutor.hpp"
 #include "Aspen/Throw.hpp"
 #include "Aspen/Traits.hpp"
+#include "Aspen/Transaction.hpp"
 #include "Aspen/Trigger.hpp"
 #include "Aspen/Unconsecutive.hpp"
 #include "Aspen/Unique.hpp"
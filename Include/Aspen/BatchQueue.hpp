@@ -0,0 +1,235 @@
+#ifndef ASPEN_BATCH_QUEUE_HPP
+#define ASPEN_BATCH_QUEUE_HPP
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Traits.hpp"
+
+namespace Aspen {
+
+  /**
+   * A reactor that evaluates to every value pushed to an internal queue since
+   * its previous commit, allowing a burst of values to be handled in a single
+   * commit.
+   * @param <T> The type of values to queue.
+   */
+  template<typename T>
+  class BatchQueue {
+    public:
+
+      /** The type of values to queue. */
+      using Value = T;
+
+      /** The type to evaluate to. */
+      using Type = std::span<const Value>;
+
+      /** Constructs an empty BatchQueue. */
+      BatchQueue();
+
+      BatchQueue(BatchQueue&& queue);
+
+      /**
+       * Pushes a value to the queue, ignored once complete.
+       * @param value The value to push.
+       */
+      void push(Value value);
+
+      /** Brings this reactor to a completion state. */
+      void set_complete();
+
+      /**
+       * Pushes a value and brings this reactor to a completion state.
+       * @param value The value to push.
+       */
+      void set_complete(Value value);
+
+      /**
+       * Sets an exception and brings this reactor to a completion state,
+       * ignored once complete. A null exception completes without one.
+       * @param exception The exception to throw.
+       */
+      void set_complete(std::exception_ptr exception);
+
+      /**
+       * Brings this reactor to a completion state by throwing an exception.
+       * @param exception The exception to throw.
+       */
+      template<std::derived_from<std::exception> E>
+      void set_complete(E exception);
+
+      State commit(std::uint64_t sequence) noexcept;
+      eval_result_t<Type> eval() const;
+
+    private:
+      std::mutex m_mutex;
+      bool m_is_complete;
+      std::vector<Value> m_entries;
+      std::exception_ptr m_exception;
+      CommitFlag* m_flag;
+      std::vector<Value> m_batch;
+      Type m_view;
+      std::exception_ptr m_current_exception;
+      bool m_has_evaluation;
+
+      void update(auto&& f);
+      BatchQueue(const BatchQueue&) = delete;
+      BatchQueue& operator =(const BatchQueue&) = delete;
+  };
+
+  /**
+   * Folds every value of each batch produced by a reactor into an accumulated
+   * value, evaluating once per batch.
+   * @param f The function used to fold a value into the accumulated value.
+   * @param initial The initial accumulated value.
+   * @param series The reactor producing batches of values.
+   * @return A reactor evaluating to the accumulated value after each batch.
+   */
+  template<typename F, typename T, typename S> requires
+    IsReactor<to_reactor_t<S>>
+  auto fold_batch(F&& f, T&& initial, S&& series) {
+    using Value = std::decay_t<T>;
+    return lift([f = std::forward<F>(f),
+        value = Value(std::forward<T>(initial))] (
+          const reactor_result_t<S>& batch) mutable {
+      for(auto& entry : batch) {
+        value = f(std::move(value), entry);
+      }
+      return value;
+    }, std::forward<S>(series));
+  }
+
+  /**
+   * Applies a function to every value of each batch produced by a reactor.
+   * @param f The function to apply to each value.
+   * @param series The reactor producing batches of values.
+   * @return A reactor evaluating once each batch has been applied.
+   */
+  template<typename F, typename S> requires IsReactor<to_reactor_t<S>>
+  auto for_each_batch(F&& f, S&& series) {
+    return lift([f = std::forward<F>(f)] (const reactor_result_t<S>& batch) {
+      for(auto& entry : batch) {
+        f(entry);
+      }
+    }, std::forward<S>(series));
+  }
+
+  template<typename T>
+  BatchQueue<T>::BatchQueue()
+    : m_is_complete(false),
+      m_flag(nullptr),
+      m_has_evaluation(false) {}
+
+  template<typename T>
+  BatchQueue<T>::BatchQueue(BatchQueue&& queue)
+      : m_flag(nullptr),
+        m_batch(std::move(queue.m_batch)),
+        m_view(m_batch),
+        m_current_exception(std::move(queue.m_current_exception)),
+        m_has_evaluation(queue.m_has_evaluation) {
+    auto lock = std::lock_guard(queue.m_mutex);
+    m_is_complete = queue.m_is_complete;
+    m_entries = std::move(queue.m_entries);
+    m_exception = std::move(queue.m_exception);
+  }
+
+  template<typename T>
+  void BatchQueue<T>::push(Value value) {
+    update([&] {
+      m_entries.push_back(std::move(value));
+    });
+  }
+
+  template<typename T>
+  void BatchQueue<T>::set_complete() {
+    update([&] {
+      m_is_complete = true;
+    });
+  }
+
+  template<typename T>
+  void BatchQueue<T>::set_complete(Value value) {
+    update([&] {
+      m_entries.push_back(std::move(value));
+      m_is_complete = true;
+    });
+  }
+
+  template<typename T>
+  void BatchQueue<T>::set_complete(std::exception_ptr exception) {
+    update([&] {
+      m_is_complete = true;
+      m_exception = std::move(exception);
+    });
+  }
+
+  template<typename T>
+  template<std::derived_from<std::exception> E>
+  void BatchQueue<T>::set_complete(E exception) {
+    set_complete(std::make_exception_ptr(std::move(exception)));
+  }
+
+  template<typename T>
+  State BatchQueue<T>::commit(std::uint64_t sequence) noexcept {
+    auto lock = std::lock_guard(m_mutex);
+    m_flag = CommitFlag::get_current();
+    if(!m_entries.empty()) {
+      m_batch.clear();
+      m_batch.swap(m_entries);
+      m_view = m_batch;
+      m_has_evaluation = true;
+      if(m_exception) {
+        return State::CONTINUE_EVALUATED;
+      } else if(m_is_complete) {
+        return State::COMPLETE_EVALUATED;
+      }
+      return State::EVALUATED;
+    } else if(m_exception) {
+      m_current_exception = std::move(m_exception);
+      m_exception = nullptr;
+      return State::COMPLETE_EVALUATED;
+    } else if(m_is_complete) {
+      return State::COMPLETE;
+    }
+    return State::NONE;
+  }
+
+  template<typename T>
+  eval_result_t<typename BatchQueue<T>::Type> BatchQueue<T>::eval() const {
+    if(m_current_exception) {
+      std::rethrow_exception(m_current_exception);
+    } else if(!m_has_evaluation) {
+      throw std::runtime_error("Uninitialized.");
+    }
+    return m_view;
+  }
+
+  template<typename T>
+  void BatchQueue<T>::update(auto&& f) {
+    auto flag = [&] () -> CommitFlag* {
+      auto lock = std::lock_guard(m_mutex);
+      if(m_is_complete) {
+        return nullptr;
+      }
+      auto was_empty = m_entries.empty();
+      f();
+      if(!was_empty) {
+        return nullptr;
+      }
+      return m_flag;
+    }();
+    if(flag) {
+      flag->raise();
+    }
+  }
+}
+
+#endif
@@ -1,20 +1,29 @@
 #ifndef ASPEN_BOX_HPP
 #define ASPEN_BOX_HPP
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <new>
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include "Aspen/GraphArena.hpp"
 #include "Aspen/Maybe.hpp"
 #include "Aspen/Reactor.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/Traits.hpp"
 
+#ifndef ASPEN_BOX_BUFFER_SIZE
+  #define ASPEN_BOX_BUFFER_SIZE (12 * sizeof(void*))
+#endif
+
 namespace Aspen {
 
   /**
-   * Wraps a reactor within a generic interface.
+   * Wraps a reactor within a generic interface. Reactors that fit within
+   * BUFFER_SIZE bytes and are nothrow movable are stored inline, all others
+   * are allocated from the current GraphArena or the heap.
    * @param <T> The type that the reactor evaluates to.
    */
   template<typename T>
@@ -27,6 +36,12 @@ namespace Aspen {
       /** The type returned by an evaluation. */
       using Result = eval_result_t<T>;
 
+      /**
+       * The number of bytes available to store a reactor inline, set by
+       * defining <code>ASPEN_BOX_BUFFER_SIZE</code>.
+       */
+      static constexpr auto BUFFER_SIZE = std::size_t(ASPEN_BOX_BUFFER_SIZE);
+
       /**
        * Constructs a Box.
        * @param reactor The reactor to wrap.
@@ -35,28 +50,29 @@ namespace Aspen {
         !std::derived_from<std::remove_cvref_t<R>, Box<T>>)
       explicit Box(R&& reactor);
 
+      Box(Box&& box) noexcept;
+      ~Box();
+
+      /** Returns <code>true</code> iff the reactor is stored inline. */
+      bool is_inline() const noexcept;
+
       State commit(std::uint64_t sequence) noexcept;
       Result eval() const;
+      Box& operator =(Box&& box) noexcept;
 
     private:
-      struct BaseWrapper {
-        virtual ~BaseWrapper() = default;
-
-        virtual State commit(std::uint64_t sequence) noexcept = 0;
-        virtual Result eval() const = 0;
-      };
       template<IsReactor R>
-      struct ByReferenceWrapper final : BaseWrapper {
+      struct ByReferenceWrapper {
         R m_reactor;
 
         template<typename Q> requires std::constructible_from<R, Q>
         explicit ByReferenceWrapper(Q&& reactor);
 
-        State commit(std::uint64_t sequence) noexcept override;
-        Result eval() const override;
+        State commit(std::uint64_t sequence) noexcept;
+        Result eval() const;
       };
       template<IsReactor R>
-      struct ByValueWrapper final : BaseWrapper {
+      struct ByValueWrapper {
         static constexpr auto is_noexcept = is_noexcept_reactor_v<R> &&
           std::is_nothrow_constructible_v<Type, reactor_evaluation_t<R>>;
         R m_reactor;
@@ -66,10 +82,60 @@ namespace Aspen {
         template<typename Q> requires std::constructible_from<R, Q>
         explicit ByValueWrapper(Q&& reactor);
 
-        State commit(std::uint64_t sequence) noexcept override;
-        Result eval() const override;
+        State commit(std::uint64_t sequence) noexcept;
+        Result eval() const;
       };
-      std::unique_ptr<BaseWrapper> m_reactor;
+      template<typename W>
+      struct InlineHolder {
+        static constexpr auto is_inline = true;
+        W m_wrapper;
+
+        template<typename Q>
+        explicit InlineHolder(Q&& reactor);
+
+        W& get() noexcept;
+        const W& get() const noexcept;
+      };
+      template<typename W>
+      struct HeapHolder {
+        static constexpr auto is_inline = false;
+        Details::arena_ptr<W> m_wrapper;
+
+        template<typename Q>
+        explicit HeapHolder(Q&& reactor);
+
+        W& get() noexcept;
+        const W& get() const noexcept;
+      };
+      struct Table {
+        State (*m_commit)(void*, std::uint64_t) noexcept;
+        Result (*m_eval)(const void*);
+        void (*m_move)(void*, void*) noexcept;
+        void (*m_destroy)(void*) noexcept;
+        bool m_is_inline;
+      };
+      template<typename W>
+      static constexpr auto is_inline_v = sizeof(InlineHolder<W>) <=
+        BUFFER_SIZE && alignof(InlineHolder<W>) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<InlineHolder<W>>;
+      template<typename W>
+      using holder_t = std::conditional_t<
+        is_inline_v<W>, InlineHolder<W>, HeapHolder<W>>;
+      static_assert(sizeof(Details::arena_ptr<std::byte>) <= BUFFER_SIZE);
+      const Table* m_table;
+      alignas(std::max_align_t) std::byte m_storage[BUFFER_SIZE];
+
+      template<typename H>
+      static const Table& get_table() noexcept;
+      template<typename H>
+      static State commit(void* holder, std::uint64_t sequence) noexcept;
+      template<typename H>
+      static Result eval(const void* holder);
+      template<typename H>
+      static void move(void* destination, void* source) noexcept;
+      template<typename H>
+      static void destroy(void* holder) noexcept;
+      void release() noexcept;
   };
 
   template<typename R> requires(!std::derived_from<
@@ -102,24 +168,97 @@ namespace Details {
     !std::derived_from<std::remove_cvref_t<R>, Box<T>>)
   Box<T>::Box(R&& reactor) {
     using Reactor = to_reactor_t<R>;
-    if constexpr(std::is_same_v<Type, void> || std::is_same_v<
-        decltype(std::declval<const Reactor&>().eval()), Result>) {
-      m_reactor =
-        std::make_unique<ByReferenceWrapper<Reactor>>(std::forward<R>(reactor));
-    } else {
-      m_reactor =
-        std::make_unique<ByValueWrapper<Reactor>>(std::forward<R>(reactor));
+    using Wrapper = std::conditional_t<std::is_same_v<Type, void> ||
+      std::is_same_v<decltype(std::declval<const Reactor&>().eval()), Result>,
+      ByReferenceWrapper<Reactor>, ByValueWrapper<Reactor>>;
+    using Holder = holder_t<Wrapper>;
+    ::new(static_cast<void*>(m_storage)) Holder(std::forward<R>(reactor));
+    m_table = &get_table<Holder>();
+  }
+
+  template<typename T>
+  Box<T>::Box(Box&& box) noexcept
+      : m_table(box.m_table) {
+    if(m_table) {
+      m_table->m_move(m_storage, box.m_storage);
+      box.m_table = nullptr;
     }
   }
 
+  template<typename T>
+  Box<T>::~Box() {
+    release();
+  }
+
+  template<typename T>
+  bool Box<T>::is_inline() const noexcept {
+    return m_table && m_table->m_is_inline;
+  }
+
   template<typename T>
   State Box<T>::commit(std::uint64_t sequence) noexcept {
-    return m_reactor->commit(sequence);
+    return m_table->m_commit(m_storage, sequence);
   }
 
   template<typename T>
   typename Box<T>::Result Box<T>::eval() const {
-    return m_reactor->eval();
+    return m_table->m_eval(m_storage);
+  }
+
+  template<typename T>
+  Box<T>& Box<T>::operator =(Box&& box) noexcept {
+    if(this == &box) {
+      return *this;
+    }
+    release();
+    m_table = box.m_table;
+    if(m_table) {
+      m_table->m_move(m_storage, box.m_storage);
+      box.m_table = nullptr;
+    }
+    return *this;
+  }
+
+  template<typename T>
+  template<typename H>
+  const typename Box<T>::Table& Box<T>::get_table() noexcept {
+    static constexpr auto table = Table{&Box::commit<H>, &Box::eval<H>,
+      &Box::move<H>, &Box::destroy<H>, H::is_inline};
+    return table;
+  }
+
+  template<typename T>
+  template<typename H>
+  State Box<T>::commit(void* holder, std::uint64_t sequence) noexcept {
+    return std::launder(static_cast<H*>(holder))->get().commit(sequence);
+  }
+
+  template<typename T>
+  template<typename H>
+  typename Box<T>::Result Box<T>::eval(const void* holder) {
+    return std::launder(static_cast<const H*>(holder))->get().eval();
+  }
+
+  template<typename T>
+  template<typename H>
+  void Box<T>::move(void* destination, void* source) noexcept {
+    auto& holder = *std::launder(static_cast<H*>(source));
+    ::new(destination) H(std::move(holder));
+    holder.~H();
+  }
+
+  template<typename T>
+  template<typename H>
+  void Box<T>::destroy(void* holder) noexcept {
+    std::launder(static_cast<H*>(holder))->~H();
+  }
+
+  template<typename T>
+  void Box<T>::release() noexcept {
+    if(m_table) {
+      m_table->m_destroy(m_storage);
+      m_table = nullptr;
+    }
   }
 
   template<typename T>
@@ -130,7 +269,8 @@ namespace Details {
 
   template<typename T>
   template<IsReactor R>
-  State Box<T>::ByReferenceWrapper<R>::commit(std::uint64_t sequence) noexcept {
+  State Box<T>::ByReferenceWrapper<R>::commit(
+      std::uint64_t sequence) noexcept {
     return m_reactor.commit(sequence);
   }
 
@@ -167,6 +307,42 @@ namespace Details {
   typename Box<T>::Result Box<T>::ByValueWrapper<R>::eval() const {
     return *m_value;
   }
+
+  template<typename T>
+  template<typename W>
+  template<typename Q>
+  Box<T>::InlineHolder<W>::InlineHolder(Q&& reactor)
+    : m_wrapper(std::forward<Q>(reactor)) {}
+
+  template<typename T>
+  template<typename W>
+  W& Box<T>::InlineHolder<W>::get() noexcept {
+    return m_wrapper;
+  }
+
+  template<typename T>
+  template<typename W>
+  const W& Box<T>::InlineHolder<W>::get() const noexcept {
+    return m_wrapper;
+  }
+
+  template<typename T>
+  template<typename W>
+  template<typename Q>
+  Box<T>::HeapHolder<W>::HeapHolder(Q&& reactor)
+    : m_wrapper(Details::make_arena_unique<W>(std::forward<Q>(reactor))) {}
+
+  template<typename T>
+  template<typename W>
+  W& Box<T>::HeapHolder<W>::get() noexcept {
+    return *m_wrapper;
+  }
+
+  template<typename T>
+  template<typename W>
+  const W& Box<T>::HeapHolder<W>::get() const noexcept {
+    return *m_wrapper;
+  }
 }
 
 #endif
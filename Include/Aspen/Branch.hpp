@@ -6,6 +6,7 @@
 #include <type_traits>
 #include <utility>
 #include "Aspen/CommitFlag.hpp"
+#include "Aspen/Profiler.hpp"
 #include "Aspen/Reactor.hpp"
 #include "Aspen/State.hpp"
 
@@ -44,6 +45,17 @@ namespace Aspen {
        */
       void set_slot(std::atomic_uint64_t* word, std::uint8_t bit) noexcept;
 
+      /**
+       * Sets a bit to raise whenever this Branch requires a commit, followed
+       * by a bit in a summary word.
+       * @param word The word containing the bit to raise.
+       * @param bit The index of the bit to raise.
+       * @param summary The summary word containing the bit to raise.
+       * @param summary_bit The index of the bit to raise in the summary.
+       */
+      void set_slot(std::atomic_uint64_t* word, std::uint8_t bit,
+        std::atomic_uint64_t* summary, std::uint8_t summary_bit) noexcept;
+
       auto& operator *(this auto&& self) noexcept;
       auto* operator ->(this auto&& self) noexcept;
       State commit(std::uint64_t sequence) noexcept;
@@ -86,6 +98,12 @@ namespace Aspen {
     m_flag.set_slot(word, bit);
   }
 
+  template<IsReactor R>
+  void Branch<R>::set_slot(std::atomic_uint64_t* word, std::uint8_t bit,
+      std::atomic_uint64_t* summary, std::uint8_t summary_bit) noexcept {
+    m_flag.set_slot(word, bit, summary, summary_bit);
+  }
+
   template<IsReactor R>
   auto& Branch<R>::operator *(this auto&& self) noexcept {
     return self.m_reactor;
@@ -106,10 +124,10 @@ namespace Aspen {
       return reset(m_state, combine(State::EVALUATED, State::CONTINUE));
     }
     m_flag.clear();
-    m_state = [&] {
+    m_state = profile_commit(m_flag, m_reactor, [&] {
       auto scope = CommitFlagScope(m_flag);
       return m_reactor.commit(sequence);
-    }();
+    });
     if(has_continuation(m_state)) {
       m_flag.raise();
     }
@@ -1,18 +1,23 @@
 #ifndef ASPEN_CELL_HPP
 #define ASPEN_CELL_HPP
+#include <algorithm>
 #include <cstdint>
 #include <mutex>
 #include <optional>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include "Aspen/CommitFlag.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/Traits.hpp"
+#include "Aspen/Transaction.hpp"
 
 namespace Aspen {
 
   /**
-   * A reactor that evaluates to the most recently set value.
+   * A reactor that evaluates to the most recently set value. Updates made
+   * while a Transaction is active on the calling thread are staged until the
+   * Transaction commits.
    * @param <T> The type to evaluate to.
    */
   template<typename T>
@@ -80,13 +85,20 @@ namespace Aspen {
       Cell& operator =(Cell&& cell);
 
     private:
+      struct Staged {
+        std::uint64_t m_version;
+        std::optional<Type> m_value;
+      };
       mutable std::mutex m_mutex;
       bool m_is_complete;
       std::optional<Type> m_current;
       std::optional<Type> m_next;
+      std::vector<Staged> m_staged;
       CommitFlag* m_flag;
 
-      void update(auto&& f);
+      void update(std::optional<Type> value, bool is_complete);
+      CommitFlag* apply(
+        std::optional<Type>& value, bool is_complete, std::uint64_t version);
   };
 
   template<typename T>
@@ -134,49 +146,29 @@ namespace Aspen {
 
   template<typename T>
   void Cell<T>::set(Type value) {
-    auto discarded = std::optional<Type>();
-    update([&] {
-      discarded.swap(m_next);
-      m_next = std::move(value);
-    });
+    update(std::move(value), false);
   }
 
   template<typename T>
   template<typename... A>
   void Cell<T>::emplace(A&&... args) {
-    auto discarded = std::optional<Type>();
-    update([&] {
-      discarded.swap(m_next);
-      m_next.emplace(std::forward<A>(args)...);
-    });
+    update(std::optional<Type>(std::in_place, std::forward<A>(args)...), false);
   }
 
   template<typename T>
   void Cell<T>::set_complete() {
-    update([&] {
-      m_is_complete = true;
-    });
+    update(std::nullopt, true);
   }
 
   template<typename T>
   void Cell<T>::set_complete(Type value) {
-    auto discarded = std::optional<Type>();
-    update([&] {
-      discarded.swap(m_next);
-      m_next = std::move(value);
-      m_is_complete = true;
-    });
+    update(std::move(value), true);
   }
 
   template<typename T>
   template<typename... A>
   void Cell<T>::emplace_complete(A&&... args) {
-    auto discarded = std::optional<Type>();
-    update([&] {
-      discarded.swap(m_next);
-      m_next.emplace(std::forward<A>(args)...);
-      m_is_complete = true;
-    });
+    update(std::optional<Type>(std::in_place, std::forward<A>(args)...), true);
   }
 
   template<typename T>
@@ -184,6 +176,19 @@ namespace Aspen {
     auto discarded = std::optional<Type>();
     auto lock = std::lock_guard(m_mutex);
     m_flag = CommitFlag::get_current();
+    if(!m_staged.empty()) {
+      auto visible = Transaction::get_visible_version();
+      auto end = std::find_if(m_staged.begin(), m_staged.end(),
+        [&] (const auto& staged) {
+          return staged.m_version > visible;
+        });
+      for(auto i = m_staged.begin(); i != end; ++i) {
+        if(i->m_value) {
+          i->m_value.swap(m_next);
+        }
+      }
+      m_staged.erase(m_staged.begin(), end);
+    }
     auto state = State::NONE;
     if(m_next) {
       discarded.swap(m_current);
@@ -191,7 +196,9 @@ namespace Aspen {
       m_next = std::nullopt;
       state = State::EVALUATED;
     }
-    if(m_is_complete) {
+    if(!m_staged.empty()) {
+      state = combine(state, State::CONTINUE);
+    } else if(m_is_complete) {
       state = combine(state, State::COMPLETE);
     }
     return state;
@@ -245,19 +252,39 @@ namespace Aspen {
   }
 
   template<typename T>
-  void Cell<T>::update(auto&& f) {
-    auto flag = [&] () -> CommitFlag* {
-      auto lock = std::lock_guard(m_mutex);
-      if(m_is_complete) {
-        return nullptr;
-      }
-      f();
-      return m_flag;
-    }();
-    if(flag) {
+  void Cell<T>::update(std::optional<Type> value, bool is_complete) {
+    if(auto transaction = Transaction::get_current()) {
+      transaction->stage([=, this, value = std::move(value)] (
+          std::uint64_t version) mutable {
+        return apply(value, is_complete, version);
+      });
+    } else if(auto flag = apply(value, is_complete, 0)) {
       flag->raise();
     }
   }
+
+  template<typename T>
+  CommitFlag* Cell<T>::apply(
+      std::optional<Type>& value, bool is_complete, std::uint64_t version) {
+    auto lock = std::lock_guard(m_mutex);
+    if(m_is_complete) {
+      return nullptr;
+    }
+    if(version == 0 && m_staged.empty()) {
+      if(value) {
+        value.swap(m_next);
+      }
+    } else {
+      if(m_staged.empty() || version > m_staged.back().m_version) {
+        m_staged.push_back(Staged(version, std::nullopt));
+      }
+      if(value) {
+        value.swap(m_staged.back().m_value);
+      }
+    }
+    m_is_complete = is_complete;
+    return m_flag;
+  }
 }
 
 #endif
@@ -4,7 +4,6 @@
 #include <atomic>
 #include <cassert>
 #include <cstdint>
-#include <memory>
 #include <vector>
 #include "Aspen/Python/DllExports.hpp"
 #include "Aspen/Trigger.hpp"
@@ -13,6 +12,8 @@ namespace Aspen {
   class CommitFlag;
 
 namespace Details {
+  struct ProfileIds;
+
   struct ASPEN_EXPORT_DLL StaticCommitFlag {
     static CommitFlag*& get() noexcept;
   };
@@ -39,6 +40,8 @@ namespace Details {
       /** Constructs a raised CommitFlag with no dependents. */
       CommitFlag() noexcept;
 
+      ~CommitFlag();
+
       /** Returns <code>true</code> iff a commit is required. */
       bool is_raised() const noexcept;
 
@@ -78,6 +81,17 @@ namespace Details {
        */
       void set_slot(std::atomic_uint64_t* word, std::uint8_t bit) noexcept;
 
+      /**
+       * Sets a bit to raise whenever this CommitFlag is raised, followed by a
+       * bit in a summary word recording that the word may have raised bits.
+       * @param word The word containing the bit to raise.
+       * @param bit The index of the bit to raise.
+       * @param summary The summary word containing the bit to raise.
+       * @param summary_bit The index of the bit to raise in the summary.
+       */
+      void set_slot(std::atomic_uint64_t* word, std::uint8_t bit,
+        std::atomic_uint64_t* summary, std::uint8_t summary_bit) noexcept;
+
       /**
        * Sets the Trigger to signal when this CommitFlag is raised, marking it
        * as the root of a graph.
@@ -96,16 +110,24 @@ namespace Details {
       using Parents = std::vector<CommitFlag*>;
       std::atomic<void*> m_pointer;
       std::atomic<std::atomic_uint64_t*> m_word;
-      std::atomic<std::shared_ptr<const Parents>> m_parents;
-      std::atomic_uint32_t m_readers;
+      std::atomic<std::atomic_uint64_t*> m_summary;
+      std::atomic<const Parents*> m_parents;
+      std::atomic_uint32_t m_readers[2];
+      std::atomic_uint8_t m_epoch;
       std::atomic_uint8_t m_flags;
       std::atomic<std::uint8_t> m_bit;
+      std::atomic<std::uint8_t> m_summary_bit;
       std::atomic<Kind> m_kind;
+#ifdef ASPEN_ENABLE_PROFILER
+      friend struct Details::ProfileIds;
+      mutable std::atomic_uint64_t m_profile_id = 0;
+#endif
 
       CommitFlag(const CommitFlag&) = delete;
       CommitFlag(CommitFlag&&) = delete;
       CommitFlag& operator =(const CommitFlag&) = delete;
       CommitFlag& operator =(CommitFlag&&) = delete;
+      void synchronize() noexcept;
       void propagate() noexcept;
   };
 
@@ -135,24 +157,34 @@ namespace Details {
   inline CommitFlag::CommitFlag() noexcept
     : m_pointer(nullptr),
       m_word(nullptr),
-      m_readers(0),
+      m_summary(nullptr),
+      m_parents(nullptr),
+      m_readers{0, 0},
+      m_epoch(0),
       m_flags(RAISED),
       m_bit(0),
+      m_summary_bit(0),
       m_kind(Kind::PLAIN) {}
 
   inline bool CommitFlag::is_raised() const noexcept {
     return (m_flags.load() & RAISED) != 0;
   }
 
+  inline CommitFlag::~CommitFlag() {
+    delete m_parents.load(std::memory_order_relaxed);
+  }
+
   inline bool CommitFlag::has_slot() const noexcept {
     return m_word.load(std::memory_order_acquire);
   }
 
   inline void CommitFlag::raise() noexcept {
-    m_readers.fetch_add(1);
+    auto& readers = m_readers[m_epoch.load()];
+    readers.fetch_add(1);
     propagate();
-    m_readers.fetch_sub(1);
-    m_readers.notify_all();
+    if(readers.fetch_sub(1) == 1) {
+      readers.notify_all();
+    }
   }
 
   inline void CommitFlag::clear() noexcept {
@@ -173,12 +205,14 @@ namespace Details {
       auto parents = m_parents.load(std::memory_order_relaxed);
       auto updated = [&] {
         if(parents) {
-          return std::make_shared<Parents>(*parents);
+          return new Parents(*parents);
         }
-        return std::make_shared<Parents>();
+        return new Parents();
       }();
       updated->push_back(&parent);
-      m_parents.store(std::move(updated));
+      m_parents.store(updated);
+      synchronize();
+      delete parents;
     }
     if(is_raised()) {
       parent.raise();
@@ -187,30 +221,30 @@ namespace Details {
 
   inline void CommitFlag::remove_parent(CommitFlag& parent) noexcept {
     auto parents = m_parents.load(std::memory_order_relaxed);
+    auto retired = static_cast<const Parents*>(nullptr);
     auto promoted = static_cast<CommitFlag*>(nullptr);
     if(m_pointer.load(std::memory_order_relaxed) == &parent) {
       if(parents && !parents->empty()) {
-        auto updated = std::make_shared<Parents>(*parents);
+        auto updated = new Parents(*parents);
         promoted = updated->back();
         m_pointer.store(promoted);
         updated->pop_back();
-        m_parents.store(std::move(updated));
+        m_parents.store(updated);
+        retired = parents;
       } else {
         m_pointer.store(nullptr);
       }
     } else if(parents) {
       auto i = std::find(parents->begin(), parents->end(), &parent);
       if(i != parents->end()) {
-        auto updated = std::make_shared<Parents>(*parents);
+        auto updated = new Parents(*parents);
         updated->erase(updated->begin() + (i - parents->begin()));
-        m_parents.store(std::move(updated));
+        m_parents.store(updated);
+        retired = parents;
       }
     }
-    auto readers = m_readers.load();
-    while(readers != 0) {
-      m_readers.wait(readers);
-      readers = m_readers.load();
-    }
+    synchronize();
+    delete retired;
     if(promoted && is_raised()) {
       promoted->raise();
     }
@@ -218,11 +252,23 @@ namespace Details {
 
   inline void CommitFlag::set_slot(
       std::atomic_uint64_t* word, std::uint8_t bit) noexcept {
-    assert(m_kind.load(std::memory_order_relaxed) != Kind::HUB && bit < 64);
+    set_slot(word, bit, nullptr, 0);
+  }
+
+  inline void CommitFlag::set_slot(std::atomic_uint64_t* word, std::uint8_t bit,
+      std::atomic_uint64_t* summary, std::uint8_t summary_bit) noexcept {
+    assert(m_kind.load(std::memory_order_relaxed) != Kind::HUB && bit < 64 &&
+      summary_bit < 64);
     m_bit.store(bit, std::memory_order_release);
+    m_summary_bit.store(summary_bit, std::memory_order_release);
+    m_summary.store(summary, std::memory_order_release);
     m_word.store(word);
     if(word && is_raised()) {
       word->fetch_or(std::uint64_t(1) << bit, std::memory_order_release);
+      if(summary) {
+        summary->fetch_or(
+          std::uint64_t(1) << summary_bit, std::memory_order_release);
+      }
     }
   }
 
@@ -233,6 +279,19 @@ namespace Details {
     m_kind.store(Kind::ROOT, std::memory_order_release);
   }
 
+  inline void CommitFlag::synchronize() noexcept {
+    for(auto i = 0; i != 2; ++i) {
+      auto epoch = m_epoch.load(std::memory_order_relaxed);
+      m_epoch.store(epoch ^ 1);
+      auto& readers = m_readers[epoch];
+      auto count = readers.load();
+      while(count != 0) {
+        readers.wait(count);
+        count = readers.load();
+      }
+    }
+  }
+
   inline void CommitFlag::propagate() noexcept {
     auto kind = m_kind.load(std::memory_order_acquire);
     if(kind == Kind::HUB) {
@@ -255,8 +314,14 @@ namespace Details {
       }
       if(auto word = m_word.load()) {
         word->fetch_or(
-          std::uint64_t(1) << m_bit.load(std::memory_order_acquire),
-          std::memory_order_release);
+          std::uint64_t(1) << m_bit.load(std::memory_order_acquire));
+        if(auto summary = m_summary.load(std::memory_order_acquire)) {
+          auto mask =
+            std::uint64_t(1) << m_summary_bit.load(std::memory_order_acquire);
+          if((summary->load() & mask) == 0) {
+            summary->fetch_or(mask);
+          }
+        }
       }
       if(kind == Kind::ROOT) {
         if(auto trigger = static_cast<Trigger*>(m_pointer.load())) {
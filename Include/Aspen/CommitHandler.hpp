@@ -9,8 +9,12 @@
 #include <utility>
 #include <vector>
 #include "Aspen/CommitFlag.hpp"
+#include "Aspen/CommitPool.hpp"
+#include "Aspen/Profiler.hpp"
 #include "Aspen/Reactor.hpp"
+#include "Aspen/SlotLayout.hpp"
 #include "Aspen/State.hpp"
+#include "Aspen/Transaction.hpp"
 
 namespace Aspen {
 
@@ -18,8 +22,9 @@ namespace Aspen {
    * Helper class used to commit a list of reactors and evaluate to their
    * aggregate state.
    * @param <R> The type of reactor to manage.
+   * @param <L> The layout of the bits raised by the children.
    */
-  template<IsReactor R>
+  template<IsReactor R, typename L = PackedSlotLayout>
   class CommitHandler {
     public:
 
@@ -30,6 +35,16 @@ namespace Aspen {
       template<typename A = std::allocator<R>>
       explicit CommitHandler(std::vector<R, A> children);
 
+      /**
+       * Constructs a CommitHandler that commits its raised children in
+       * parallel, which requires that no two children share a reactor.
+       * @param children The reactors whose commits are to be managed.
+       * @param pool The CommitPool used to commit the children, which must
+       *        outlive this handler.
+       */
+      template<typename A = std::allocator<R>>
+      CommitHandler(std::vector<R, A> children, CommitPool& pool);
+
       CommitHandler(CommitHandler&& handler) noexcept;
 
       /**
@@ -55,6 +70,7 @@ namespace Aspen {
 
     private:
       static constexpr auto BITS = std::size_t(64);
+      static constexpr auto SLOTS = L::SLOTS_PER_WORD;
       struct Child {
         CommitFlag m_flag;
         [[no_unique_address]]
@@ -67,9 +83,13 @@ namespace Aspen {
         Child(Child&& child) noexcept;
       };
       std::size_t m_word_count;
-      std::unique_ptr<std::atomic_uint64_t[]> m_raised;
+      std::size_t m_summary_count;
+      std::unique_ptr<typename L::Word[]> m_raised;
+      std::unique_ptr<std::atomic_uint64_t[]> m_summary;
       std::vector<Child> m_children;
       std::vector<std::size_t> m_evaluated;
+      std::vector<std::size_t> m_pending;
+      CommitPool* m_pool;
       std::size_t m_completion_count;
       std::size_t m_evaluation_count;
       bool m_is_initializing;
@@ -77,26 +97,35 @@ namespace Aspen {
       CommitFlag* m_parent;
 
       void link() noexcept;
+      template<typename F>
+      bool for_each_raised(F&& f) noexcept;
+      void commit(Child& child, std::uint64_t sequence) noexcept;
+      bool update(std::size_t index, bool& has_continue) noexcept;
+      State commit_parallel(std::uint64_t sequence) noexcept;
+      State aggregate(bool has_continue) noexcept;
   };
 
-  template<IsReactor R>
+  template<IsReactor R, typename L>
   template<typename U> requires std::constructible_from<R, U>
-  CommitHandler<R>::Child::Child(U&& reactor)
+  CommitHandler<R, L>::Child::Child(U&& reactor)
     : m_reactor(std::forward<U>(reactor)),
       m_state(State::NONE),
       m_has_evaluation(false) {}
 
-  template<IsReactor R>
-  CommitHandler<R>::Child::Child(Child&& child) noexcept
+  template<IsReactor R, typename L>
+  CommitHandler<R, L>::Child::Child(Child&& child) noexcept
     : m_reactor(std::move(child.m_reactor)),
       m_state(child.m_state),
       m_has_evaluation(child.m_has_evaluation) {}
 
-  template<IsReactor R>
+  template<IsReactor R, typename L>
   template<typename A>
-  CommitHandler<R>::CommitHandler(std::vector<R, A> children)
-      : m_word_count((children.size() + BITS - 1) / BITS),
-        m_raised(std::make_unique<std::atomic_uint64_t[]>(m_word_count)),
+  CommitHandler<R, L>::CommitHandler(std::vector<R, A> children)
+      : m_word_count((children.size() + SLOTS - 1) / SLOTS),
+        m_summary_count((m_word_count + BITS - 1) / BITS),
+        m_raised(std::make_unique<typename L::Word[]>(m_word_count)),
+        m_summary(std::make_unique<std::atomic_uint64_t[]>(m_summary_count)),
+        m_pool(nullptr),
         m_completion_count(0),
         m_evaluation_count(0),
         m_is_initializing(true),
@@ -108,28 +137,45 @@ namespace Aspen {
     }
   }
 
-  template<IsReactor R>
-  CommitHandler<R>::CommitHandler(CommitHandler&& handler) noexcept
+  template<IsReactor R, typename L>
+  template<typename A>
+  CommitHandler<R, L>::CommitHandler(
+      std::vector<R, A> children, CommitPool& pool)
+      : CommitHandler(std::move(children)) {
+    m_pool = &pool;
+    m_pending.reserve(m_children.size());
+  }
+
+  template<IsReactor R, typename L>
+  CommitHandler<R, L>::CommitHandler(CommitHandler&& handler) noexcept
     : m_word_count(handler.m_word_count),
+      m_summary_count(handler.m_summary_count),
       m_raised(std::move(handler.m_raised)),
+      m_summary(std::move(handler.m_summary)),
       m_children(std::move(handler.m_children)),
       m_evaluated(std::move(handler.m_evaluated)),
+      m_pending(std::move(handler.m_pending)),
+      m_pool(handler.m_pool),
       m_completion_count(handler.m_completion_count),
       m_evaluation_count(handler.m_evaluation_count),
       m_is_initializing(handler.m_is_initializing),
       m_is_linked(false),
       m_parent(nullptr) {}
 
-  template<IsReactor R>
-  CommitHandler<R>& CommitHandler<R>::operator =(
+  template<IsReactor R, typename L>
+  CommitHandler<R, L>& CommitHandler<R, L>::operator =(
       CommitHandler&& handler) noexcept {
     if(this == &handler) {
       return *this;
     }
     m_children = std::move(handler.m_children);
     m_evaluated = std::move(handler.m_evaluated);
+    m_pending = std::move(handler.m_pending);
+    m_pool = handler.m_pool;
     m_raised = std::move(handler.m_raised);
+    m_summary = std::move(handler.m_summary);
     m_word_count = handler.m_word_count;
+    m_summary_count = handler.m_summary_count;
     m_completion_count = handler.m_completion_count;
     m_evaluation_count = handler.m_evaluation_count;
     m_is_initializing = handler.m_is_initializing;
@@ -140,63 +186,138 @@ namespace Aspen {
     return *this;
   }
 
-  template<IsReactor R>
-  void CommitHandler<R>::link() noexcept {
+  template<IsReactor R, typename L>
+  void CommitHandler<R, L>::link() noexcept {
     m_is_linked = true;
     auto parent = CommitFlag::get_current();
     m_parent = parent;
     for(auto i = std::size_t(0); i != m_children.size(); ++i) {
       auto& flag = m_children[i].m_flag;
       flag.set_parent(parent);
-      flag.set_slot(&m_raised[i / BITS], static_cast<std::uint8_t>(i % BITS));
+      auto word = i / SLOTS;
+      flag.set_slot(&m_raised[word].m_bits,
+        static_cast<std::uint8_t>(i % SLOTS),
+        &m_summary[word / BITS], static_cast<std::uint8_t>(word % BITS));
+    }
+  }
+
+  template<IsReactor R, typename L>
+  template<typename F>
+  bool CommitHandler<R, L>::for_each_raised(F&& f) noexcept {
+    for(auto group = std::size_t(0); group != m_summary_count; ++group) {
+      if(m_summary[group].load(std::memory_order_acquire) == 0) {
+        continue;
+      }
+      auto words = m_summary[group].exchange(0);
+      while(words != 0) {
+        auto word = group * BITS + std::countr_zero(words);
+        words &= words - 1;
+        auto bits = m_raised[word].m_bits.exchange(0);
+        while(bits != 0) {
+          auto index = word * SLOTS + std::countr_zero(bits);
+          bits &= bits - 1;
+          if(!f(index)) {
+            return false;
+          }
+        }
+      }
     }
+    return true;
   }
 
-  template<IsReactor R>
-  State CommitHandler<R>::commit(std::uint64_t sequence) noexcept {
+  template<IsReactor R, typename L>
+  State CommitHandler<R, L>::commit(std::uint64_t sequence) noexcept {
     if(m_children.empty()) {
       return State::COMPLETE;
     }
     if(!m_is_linked) {
       link();
     }
+    if(m_pool) {
+      return commit_parallel(sequence);
+    }
     m_evaluated.clear();
     auto has_continue = false;
-    for(auto word = std::size_t(0); word != m_word_count; ++word) {
-      if(m_raised[word].load(std::memory_order_acquire) == 0) {
-        continue;
+    auto is_running = for_each_raised([&] (std::size_t index) {
+      auto& child = m_children[index];
+      if(is_complete(child.m_state)) {
+        return true;
       }
-      auto bits = m_raised[word].exchange(0, std::memory_order_acq_rel);
-      while(bits != 0) {
-        auto index = word * BITS + std::countr_zero(bits);
-        bits &= bits - 1;
-        auto& child = m_children[index];
-        if(is_complete(child.m_state)) {
-          continue;
-        }
-        child.m_flag.clear();
-        {
-          auto scope = CommitFlagScope(child.m_flag);
-          child.m_state = child.m_reactor.commit(sequence);
-        }
-        if(has_evaluation(child.m_state)) {
-          m_evaluated.push_back(index);
-          if(!child.m_has_evaluation) {
-            child.m_has_evaluation = true;
-            ++m_evaluation_count;
-          }
-        }
-        if(is_complete(child.m_state)) {
-          ++m_completion_count;
-          if(!child.m_has_evaluation) {
-            return State::COMPLETE;
-          }
-        } else if(has_continuation(child.m_state)) {
-          has_continue = true;
-          child.m_flag.raise();
-        }
+      commit(child, sequence);
+      return update(index, has_continue);
+    });
+    if(!is_running) {
+      return State::COMPLETE;
+    }
+    return aggregate(has_continue);
+  }
+
+  template<IsReactor R, typename L>
+  void CommitHandler<R, L>::commit(
+      Child& child, std::uint64_t sequence) noexcept {
+    child.m_flag.clear();
+    child.m_state = profile_commit(child.m_flag, child.m_reactor, [&] {
+      auto scope = CommitFlagScope(child.m_flag);
+      return child.m_reactor.commit(sequence);
+    });
+  }
+
+  template<IsReactor R, typename L>
+  bool CommitHandler<R, L>::update(
+      std::size_t index, bool& has_continue) noexcept {
+    auto& child = m_children[index];
+    if(has_evaluation(child.m_state)) {
+      m_evaluated.push_back(index);
+      if(!child.m_has_evaluation) {
+        child.m_has_evaluation = true;
+        ++m_evaluation_count;
       }
     }
+    if(is_complete(child.m_state)) {
+      ++m_completion_count;
+      if(!child.m_has_evaluation) {
+        return false;
+      }
+    } else if(has_continuation(child.m_state)) {
+      has_continue = true;
+      child.m_flag.raise();
+    }
+    return true;
+  }
+
+  template<IsReactor R, typename L>
+  State CommitHandler<R, L>::commit_parallel(std::uint64_t sequence) noexcept {
+    m_pending.clear();
+    for_each_raised([&] (std::size_t index) {
+      if(!is_complete(m_children[index].m_state)) {
+        m_pending.push_back(index);
+      }
+      return true;
+    });
+    auto parent = CommitFlag::get_current();
+    auto version = Transaction::get_visible_version();
+    m_pool->run(m_pending.size(), [&] (std::size_t i) noexcept {
+      auto& child = m_children[m_pending[i]];
+      auto snapshot = TransactionSnapshot(version);
+      if(parent) {
+        auto scope = CommitFlagScope(*parent);
+        commit(child, sequence);
+      } else {
+        commit(child, sequence);
+      }
+    });
+    m_evaluated.clear();
+    auto has_continue = false;
+    for(auto index : m_pending) {
+      if(!update(index, has_continue)) {
+        return State::COMPLETE;
+      }
+    }
+    return aggregate(has_continue);
+  }
+
+  template<IsReactor R, typename L>
+  State CommitHandler<R, L>::aggregate(bool has_continue) noexcept {
     auto state = State::NONE;
     if(m_is_initializing) {
       if(m_evaluation_count == m_children.size()) {
@@ -214,19 +335,19 @@ namespace Aspen {
     return state;
   }
 
-  template<IsReactor R>
+  template<IsReactor R, typename L>
   const std::vector<std::size_t>&
-      CommitHandler<R>::get_evaluated() const noexcept {
+      CommitHandler<R, L>::get_evaluated() const noexcept {
     return m_evaluated;
   }
 
-  template<IsReactor R>
-  std::size_t CommitHandler<R>::size() const noexcept {
+  template<IsReactor R, typename L>
+  std::size_t CommitHandler<R, L>::size() const noexcept {
     return m_children.size();
   }
 
-  template<IsReactor R>
-  auto& CommitHandler<R>::get(this auto&& self, std::size_t index) noexcept {
+  template<IsReactor R, typename L>
+  auto& CommitHandler<R, L>::get(this auto&& self, std::size_t index) noexcept {
     return self.m_children[index].m_reactor;
   }
 }
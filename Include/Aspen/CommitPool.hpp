@@ -0,0 +1,173 @@
+#ifndef ASPEN_COMMIT_POOL_HPP
+#define ASPEN_COMMIT_POOL_HPP
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace Aspen {
+
+  /**
+   * A pool of worker threads used to commit the children of a reactor in
+   * parallel. The thread calling run takes part in the work, wakes at most one
+   * worker per remaining task and returns once every task has finished.
+   * Nested or concurrent calls to run execute on the calling thread, so the
+   * pool can be shared by an entire graph.
+   */
+  class CommitPool {
+    public:
+
+      /**
+       * Constructs a CommitPool with one worker per core, less the committing
+       * thread.
+       */
+      CommitPool();
+
+      /**
+       * Constructs a CommitPool.
+       * @param thread_count The number of worker threads to run in addition
+       *        to the committing thread.
+       */
+      explicit CommitPool(std::size_t thread_count);
+
+      /** Joins all worker threads. */
+      ~CommitPool();
+
+      /** Returns the number of worker threads. */
+      std::size_t get_thread_count() const noexcept;
+
+      /**
+       * Calls a task once for every index in a range and waits for all calls
+       * to finish.
+       * @param count The number of indices to call the <i>task</i> with.
+       * @param task The callable invoked with each index in [0, count).
+       */
+      template<typename F>
+      void run(std::size_t count, F&& task) noexcept;
+
+    private:
+      using Invoker = void (*)(void*, std::size_t) noexcept;
+      std::mutex m_mutex;
+      std::condition_variable m_work_condition;
+      std::condition_variable m_completion_condition;
+      std::size_t m_slots;
+      std::size_t m_active;
+      bool m_is_stopped;
+      std::atomic_bool m_is_running;
+      std::atomic_size_t m_next;
+      std::size_t m_count;
+      Invoker m_invoker;
+      void* m_task;
+      std::vector<std::thread> m_threads;
+
+      void drain() noexcept;
+      void work() noexcept;
+      CommitPool(const CommitPool&) = delete;
+      CommitPool& operator =(const CommitPool&) = delete;
+  };
+
+  inline CommitPool::CommitPool()
+    : CommitPool(std::max(std::thread::hardware_concurrency(), 1U) - 1) {}
+
+  inline CommitPool::CommitPool(std::size_t thread_count)
+      : m_slots(0),
+        m_active(0),
+        m_is_stopped(false),
+        m_is_running(false),
+        m_next(0),
+        m_count(0),
+        m_invoker(nullptr),
+        m_task(nullptr) {
+    m_threads.reserve(thread_count);
+    for(auto i = std::size_t(0); i != thread_count; ++i) {
+      m_threads.emplace_back([this] {
+        work();
+      });
+    }
+  }
+
+  inline CommitPool::~CommitPool() {
+    {
+      auto lock = std::lock_guard(m_mutex);
+      m_is_stopped = true;
+    }
+    m_work_condition.notify_all();
+    for(auto& thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  inline std::size_t CommitPool::get_thread_count() const noexcept {
+    return m_threads.size();
+  }
+
+  template<typename F>
+  void CommitPool::run(std::size_t count, F&& task) noexcept {
+    if(count < 2 || m_threads.empty() || m_is_running.exchange(true)) {
+      for(auto i = std::size_t(0); i != count; ++i) {
+        task(i);
+      }
+      return;
+    }
+    auto workers = std::min(count - 1, m_threads.size());
+    {
+      auto lock = std::lock_guard(m_mutex);
+      m_task = std::addressof(task);
+      m_invoker = [] (void* task, std::size_t index) noexcept {
+        (*static_cast<std::remove_reference_t<F>*>(task))(index);
+      };
+      m_count = count;
+      m_next.store(0, std::memory_order_relaxed);
+      m_slots = workers;
+      m_active = workers;
+    }
+    for(auto i = std::size_t(0); i != workers; ++i) {
+      m_work_condition.notify_one();
+    }
+    drain();
+    {
+      auto lock = std::unique_lock(m_mutex);
+      m_completion_condition.wait(lock, [&] {
+        return m_active == 0;
+      });
+    }
+    m_is_running.store(false);
+  }
+
+  inline void CommitPool::drain() noexcept {
+    while(true) {
+      auto index = m_next.fetch_add(1, std::memory_order_relaxed);
+      if(index >= m_count) {
+        return;
+      }
+      m_invoker(m_task, index);
+    }
+  }
+
+  inline void CommitPool::work() noexcept {
+    while(true) {
+      {
+        auto lock = std::unique_lock(m_mutex);
+        m_work_condition.wait(lock, [&] {
+          return m_is_stopped || m_slots != 0;
+        });
+        if(m_is_stopped) {
+          return;
+        }
+        --m_slots;
+      }
+      drain();
+      auto lock = std::lock_guard(m_mutex);
+      if(--m_active == 0) {
+        m_completion_condition.notify_one();
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,413 @@
+#ifndef ASPEN_COMPILED_GRAPH_HPP
+#define ASPEN_COMPILED_GRAPH_HPP
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Aspen/Branch.hpp"
+#include "Aspen/GraphArena.hpp"
+#include "Aspen/Maybe.hpp"
+#include "Aspen/Reactor.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Traits.hpp"
+
+namespace Aspen {
+  class GraphBuilder;
+
+  template<typename T>
+  class CompiledGraph;
+
+namespace Details {
+  template<typename T>
+  struct GraphValue {
+    Maybe<T> m_value;
+    std::uint64_t m_evaluation;
+    bool m_has_value;
+    bool m_is_complete;
+
+    GraphValue() noexcept
+      : m_evaluation(0),
+        m_has_value(false),
+        m_is_complete(false) {}
+  };
+
+  template<IsReactor R>
+  struct GraphSource {
+    using Type = reactor_result_t<R>;
+    GraphValue<Type> m_value;
+    Branch<R> m_branch;
+
+    template<typename A>
+    explicit GraphSource(A&& reactor)
+      : m_branch(std::forward<A>(reactor)) {}
+
+    State update(std::uint64_t sequence, std::uint64_t epoch) noexcept {
+      auto state = m_branch.commit(sequence);
+      if(has_evaluation(state)) {
+        m_value.m_value = try_call([&] () -> decltype(auto) {
+          return m_branch->eval();
+        });
+        m_value.m_evaluation = epoch;
+        m_value.m_has_value = true;
+      }
+      m_value.m_is_complete = is_complete(state);
+      return state;
+    }
+  };
+
+  template<typename T, typename F, typename... A>
+  struct GraphFunction {
+    using Type = T;
+    GraphValue<Type> m_value;
+    [[no_unique_address]]
+    F m_function;
+    std::tuple<const GraphValue<A>*...> m_arguments;
+
+    template<typename FF>
+    GraphFunction(FF&& function, const GraphValue<A>*... arguments)
+      : m_function(std::forward<FF>(function)),
+        m_arguments(arguments...) {}
+
+    State update(std::uint64_t, std::uint64_t epoch) noexcept {
+      return std::apply([&] (const auto*... arguments) {
+        auto is_complete = (arguments->m_is_complete && ...) ||
+          ((arguments->m_is_complete && !arguments->m_has_value) || ...);
+        if(!(arguments->m_has_value && ...) ||
+            !((arguments->m_evaluation == epoch) || ...)) {
+          m_value.m_is_complete = is_complete;
+          return is_complete ? State::COMPLETE : State::NONE;
+        }
+        m_value.m_value = try_call([&] {
+          return std::invoke(m_function, arguments->m_value.get()...);
+        });
+        m_value.m_evaluation = epoch;
+        m_value.m_has_value = true;
+        m_value.m_is_complete = is_complete;
+        if(is_complete) {
+          return State::COMPLETE_EVALUATED;
+        }
+        return State::EVALUATED;
+      }, m_arguments);
+    }
+  };
+
+  struct GraphVertex {
+    using Update = State (*)(void*, std::uint64_t, std::uint64_t) noexcept;
+    using Link = void (*)(void*, std::atomic_uint64_t*, std::uint8_t) noexcept;
+    using Destructor = void (*)(void*) noexcept;
+    Update m_update;
+    Link m_link;
+    Destructor m_destructor;
+    void* m_node;
+    std::uint32_t m_first_dependent;
+    std::uint32_t m_last_dependent;
+  };
+
+  struct GraphStorage {
+    std::unique_ptr<GraphArena> m_arena;
+    std::vector<GraphVertex> m_vertices;
+
+    GraphStorage()
+      : m_arena(std::make_unique<GraphArena>()) {}
+
+    GraphStorage(GraphStorage&& storage) noexcept
+      : m_arena(std::move(storage.m_arena)),
+        m_vertices(std::exchange(storage.m_vertices, {})) {}
+
+    ~GraphStorage() {
+      for(auto i = m_vertices.rbegin(); i != m_vertices.rend(); ++i) {
+        i->m_destructor(i->m_node);
+      }
+    }
+
+    GraphStorage& operator =(GraphStorage&& storage) noexcept {
+      std::swap(m_arena, storage.m_arena);
+      std::swap(m_vertices, storage.m_vertices);
+      return *this;
+    }
+
+    template<typename N, typename... A>
+    N* emplace(A&&... arguments) {
+      m_vertices.reserve(m_vertices.size() + 1);
+      auto memory = m_arena->allocate(sizeof(N), alignof(N));
+      auto node = static_cast<N*>(nullptr);
+      try {
+        node = ::new(memory) N(std::forward<A>(arguments)...);
+      } catch(...) {
+        m_arena->deallocate(memory, sizeof(N));
+        throw;
+      }
+      auto& vertex = m_vertices.emplace_back();
+      vertex.m_update = [] (void* node, std::uint64_t sequence,
+          std::uint64_t epoch) noexcept {
+        return static_cast<N*>(node)->update(sequence, epoch);
+      };
+      vertex.m_link = nullptr;
+      vertex.m_destructor = [] (void* node) noexcept {
+        static_cast<N*>(node)->~N();
+      };
+      vertex.m_node = node;
+      vertex.m_first_dependent = 0;
+      vertex.m_last_dependent = 0;
+      return node;
+    }
+  };
+}
+
+  /**
+   * Refers to a node added to a GraphBuilder.
+   * @param <T> The type the node evaluates to.
+   */
+  template<typename T>
+  class GraphNode {
+    public:
+
+      /** The type the node evaluates to. */
+      using Type = T;
+
+      /** Returns the node's topological index within its graph. */
+      std::size_t get_index() const noexcept;
+
+    private:
+      friend class GraphBuilder;
+      std::size_t m_index;
+      const Details::GraphValue<Type>* m_value;
+
+      GraphNode(std::size_t index, const Details::GraphValue<Type>* value);
+  };
+
+  /**
+   * Builds a CompiledGraph out of source reactors and the functions applied to
+   * them. Every node must be built from nodes that were added before it, so the
+   * order nodes are added in is a topological order of the graph.
+   */
+  class GraphBuilder {
+    public:
+
+      /** Constructs an empty GraphBuilder. */
+      GraphBuilder() = default;
+
+      /**
+       * Adds a reactor whose evaluations feed the graph.
+       * @param reactor The reactor to add.
+       * @return The node evaluating to the <i>reactor</i>.
+       */
+      template<typename R> requires
+        (!std::is_void_v<reactor_result_t<R>>)
+      GraphNode<reactor_result_t<R>> source(R&& reactor);
+
+      /**
+       * Adds a node that applies a function to other nodes whenever any of
+       * them evaluates and all of them have a value. An exception thrown by
+       * the function, or stored by any of its arguments, is stored by the node.
+       * @param function The function to apply.
+       * @param arguments The nodes to apply the <i>function</i> to.
+       * @return The node evaluating to the <i>function</i>'s result.
+       */
+      template<typename F, typename A, typename... B> requires
+        std::invocable<std::decay_t<F>&, const A&, const B&...> &&
+        (!std::is_void_v<std::invoke_result_t<
+          std::decay_t<F>&, const A&, const B&...>>)
+      GraphNode<std::decay_t<std::invoke_result_t<
+        std::decay_t<F>&, const A&, const B&...>>> lift(F&& function,
+          GraphNode<A> argument, GraphNode<B>... arguments);
+
+      /**
+       * Compiles the nodes added so far into a reactor, leaving this builder
+       * empty.
+       * @param output The node the compiled graph evaluates to.
+       * @return A reactor evaluating to the <i>output</i>.
+       */
+      template<typename T>
+      CompiledGraph<T> compile(GraphNode<T> output);
+
+    private:
+      Details::GraphStorage m_storage;
+      std::vector<std::vector<std::uint32_t>> m_dependents;
+
+      GraphBuilder(const GraphBuilder&) = delete;
+      GraphBuilder& operator =(const GraphBuilder&) = delete;
+  };
+
+  /**
+   * A reactor that evaluates a graph laid out as a flat array of nodes in
+   * topological order. Rather than recursing through nested reactors, each
+   * commit walks the raised and dirty nodes in index order, so every node is
+   * updated at most once, after all of its dependencies.
+   * @param <T> The type the graph evaluates to.
+   */
+  template<typename T>
+  class CompiledGraph {
+    public:
+
+      /** The type the graph evaluates to. */
+      using Type = T;
+
+      CompiledGraph(CompiledGraph&&) = default;
+
+      /** Returns the number of nodes in the graph. */
+      std::size_t get_size() const noexcept;
+
+      State commit(std::uint64_t sequence) noexcept;
+      const Type& eval() const;
+
+    private:
+      friend class GraphBuilder;
+      static constexpr auto BITS = std::size_t(64);
+      Details::GraphStorage m_storage;
+      std::vector<std::uint32_t> m_dependents;
+      std::unique_ptr<std::atomic_uint64_t[]> m_raised;
+      std::vector<std::uint64_t> m_dirty;
+      const Details::GraphValue<Type>* m_output;
+      std::uint64_t m_epoch;
+
+      CompiledGraph(Details::GraphStorage storage,
+        std::vector<std::uint32_t> dependents,
+        const Details::GraphValue<Type>* output);
+  };
+
+  template<typename T>
+  std::size_t GraphNode<T>::get_index() const noexcept {
+    return m_index;
+  }
+
+  template<typename T>
+  GraphNode<T>::GraphNode(
+    std::size_t index, const Details::GraphValue<Type>* value)
+    : m_index(index),
+      m_value(value) {}
+
+  template<typename R> requires (!std::is_void_v<reactor_result_t<R>>)
+  GraphNode<reactor_result_t<R>> GraphBuilder::source(R&& reactor) {
+    using Source = Details::GraphSource<to_reactor_t<R>>;
+    auto source = m_storage.emplace<Source>(std::forward<R>(reactor));
+    m_storage.m_vertices.back().m_link = [] (void* node,
+        std::atomic_uint64_t* word, std::uint8_t bit) noexcept {
+      static_cast<Source*>(node)->m_branch.set_slot(word, bit);
+    };
+    m_dependents.emplace_back();
+    return GraphNode<reactor_result_t<R>>(
+      m_storage.m_vertices.size() - 1, &source->m_value);
+  }
+
+  template<typename F, typename A, typename... B> requires
+    std::invocable<std::decay_t<F>&, const A&, const B&...> &&
+    (!std::is_void_v<std::invoke_result_t<
+      std::decay_t<F>&, const A&, const B&...>>)
+  GraphNode<std::decay_t<std::invoke_result_t<
+      std::decay_t<F>&, const A&, const B&...>>> GraphBuilder::lift(
+        F&& function, GraphNode<A> argument, GraphNode<B>... arguments) {
+    using Type = std::decay_t<
+      std::invoke_result_t<std::decay_t<F>&, const A&, const B&...>>;
+    using Function = Details::GraphFunction<Type, std::decay_t<F>, A, B...>;
+    auto index = m_storage.m_vertices.size();
+    assert(argument.m_index < index && ((arguments.m_index < index) && ...));
+    auto node = m_storage.emplace<Function>(std::forward<F>(function),
+      argument.m_value, arguments.m_value...);
+    m_dependents.emplace_back();
+    for(auto dependency : {argument.m_index, arguments.m_index...}) {
+      auto& dependents = m_dependents[dependency];
+      if(dependents.empty() || dependents.back() != index) {
+        dependents.push_back(static_cast<std::uint32_t>(index));
+      }
+    }
+    return GraphNode<Type>(index, &node->m_value);
+  }
+
+  template<typename T>
+  CompiledGraph<T> GraphBuilder::compile(GraphNode<T> output) {
+    auto dependents = std::vector<std::uint32_t>();
+    auto& vertices = m_storage.m_vertices;
+    for(auto i = std::size_t(0); i != vertices.size(); ++i) {
+      vertices[i].m_first_dependent =
+        static_cast<std::uint32_t>(dependents.size());
+      dependents.insert(
+        dependents.end(), m_dependents[i].begin(), m_dependents[i].end());
+      vertices[i].m_last_dependent =
+        static_cast<std::uint32_t>(dependents.size());
+    }
+    m_dependents.clear();
+    return CompiledGraph<T>(
+      std::exchange(m_storage, {}), std::move(dependents), output.m_value);
+  }
+
+  template<typename T>
+  CompiledGraph<T>::CompiledGraph(Details::GraphStorage storage,
+      std::vector<std::uint32_t> dependents,
+      const Details::GraphValue<Type>* output)
+      : m_storage(std::move(storage)),
+        m_dependents(std::move(dependents)),
+        m_output(output),
+        m_epoch(0) {
+    auto& vertices = m_storage.m_vertices;
+    auto words = (vertices.size() + BITS - 1) / BITS;
+    m_raised = std::make_unique<std::atomic_uint64_t[]>(words);
+    m_dirty.resize(words, 0);
+    for(auto i = std::size_t(0); i != vertices.size(); ++i) {
+      if(vertices[i].m_link) {
+        vertices[i].m_link(vertices[i].m_node, &m_raised[i / BITS],
+          static_cast<std::uint8_t>(i % BITS));
+      }
+    }
+  }
+
+  template<typename T>
+  std::size_t CompiledGraph<T>::get_size() const noexcept {
+    return m_storage.m_vertices.size();
+  }
+
+  template<typename T>
+  State CompiledGraph<T>::commit(std::uint64_t sequence) noexcept {
+    ++m_epoch;
+    auto is_continuing = false;
+    auto& vertices = m_storage.m_vertices;
+    for(auto word = std::size_t(0); word != m_dirty.size(); ++word) {
+      auto bits = m_raised[word].exchange(0) | std::exchange(m_dirty[word], 0);
+      while(bits != 0) {
+        auto index = word * BITS + std::countr_zero(bits);
+        bits &= bits - 1;
+        auto& vertex = vertices[index];
+        auto state = vertex.m_update(vertex.m_node, sequence, m_epoch);
+        is_continuing |= has_continuation(state);
+        if(has_evaluation(state) || is_complete(state)) {
+          for(auto i = vertex.m_first_dependent; i != vertex.m_last_dependent;
+              ++i) {
+            auto dependent = m_dependents[i];
+            m_dirty[dependent / BITS] |=
+              std::uint64_t(1) << (dependent % BITS);
+          }
+          bits |= std::exchange(m_dirty[word], 0);
+        }
+      }
+    }
+    if(m_output->m_is_complete) {
+      if(m_output->m_evaluation == m_epoch) {
+        return State::COMPLETE_EVALUATED;
+      }
+      return State::COMPLETE;
+    }
+    auto state = State::NONE;
+    if(m_output->m_evaluation == m_epoch) {
+      state = State::EVALUATED;
+    }
+    if(is_continuing) {
+      state = combine(state, State::CONTINUE);
+    }
+    return state;
+  }
+
+  template<typename T>
+  const typename CompiledGraph<T>::Type& CompiledGraph<T>::eval() const {
+    return m_output->m_value.get();
+  }
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include <vector>
 #include "Aspen/Branch.hpp"
 #include "Aspen/Reactor.hpp"
+#include "Aspen/SlotLayout.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/Traits.hpp"
 
@@ -22,8 +23,10 @@ namespace Aspen {
    * Implements a reactor that evaluates to every value produced by its
    * children.
    * @param <T> The type of reactor producing the reactors to evaluate to.
+   * @param <L> The layout of the bits raised by the children.
    */
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
+  template<IsReactor T, typename L = PackedSlotLayout> requires
+    IsReactor<reactor_result_t<T>>
   class Concur {
     public:
 
@@ -49,6 +52,7 @@ namespace Aspen {
 
     private:
       static constexpr auto BITS = std::size_t(64);
+      static constexpr auto SLOTS = L::SLOTS_PER_WORD;
       static constexpr auto NO_CHILD = std::size_t(-1);
       struct Child {
         Branch<reactor_result_t<T>> m_reactor;
@@ -60,7 +64,8 @@ namespace Aspen {
       };
       std::optional<Branch<T>> m_producer;
       std::deque<std::optional<Child>> m_children;
-      std::deque<std::atomic_uint64_t> m_raised;
+      std::deque<typename L::Word> m_raised;
+      std::deque<std::atomic_uint64_t> m_summary;
       std::vector<std::size_t> m_free;
       std::size_t m_count;
       std::size_t m_current;
@@ -71,8 +76,8 @@ namespace Aspen {
       void raise_slot(std::size_t index) noexcept;
       void clear_slot(std::size_t index) noexcept;
       std::size_t next(std::size_t index) const noexcept;
-      std::size_t find_raised(
-        std::size_t from, std::size_t count) const noexcept;
+      std::size_t next_raised_word(std::size_t word) noexcept;
+      std::size_t find_raised(std::size_t from, std::size_t count) noexcept;
   };
 
   template<typename T> requires(
@@ -90,22 +95,22 @@ namespace Aspen {
     return Concur(std::forward<T>(producer));
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
   template<typename U> requires std::constructible_from<reactor_result_t<T>, U>
-  Concur<T>::Child::Child(U&& reactor)
+  Concur<T, L>::Child::Child(U&& reactor)
     : m_reactor(std::forward<U>(reactor)),
       m_is_complete(false) {}
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
   template<typename TF> requires std::constructible_from<T, TF>
-  Concur<T>::Concur(TF&& producer)
+  Concur<T, L>::Concur(TF&& producer)
     : m_producer(std::forward<TF>(producer)),
       m_count(0),
       m_current(NO_CHILD),
       m_position(0) {}
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  State Concur<T>::commit(std::uint64_t sequence) noexcept {
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  State Concur<T, L>::commit(std::uint64_t sequence) noexcept {
     auto state = [&] {
       if(m_producer) {
         auto producer_state = m_producer->commit(sequence);
@@ -178,13 +183,14 @@ namespace Aspen {
     return state;
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  typename Concur<T>::Result Concur<T>::eval() const noexcept(is_noexcept) {
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  typename Concur<T, L>::Result
+      Concur<T, L>::eval() const noexcept(is_noexcept) {
     return m_children[m_current]->m_reactor->eval();
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  void Concur<T>::add(auto&& reactor) {
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  void Concur<T, L>::add(auto&& reactor) {
     auto index = std::size_t(0);
     if(m_free.empty()) {
       index = m_children.size();
@@ -193,9 +199,12 @@ namespace Aspen {
       }
       m_children.emplace_back(
         std::in_place, std::forward<decltype(reactor)>(reactor));
-      if(index % BITS == 0) {
+      if(index % SLOTS == 0) {
         try {
-          m_raised.emplace_back(0);
+          if(m_summary.size() * BITS == index / SLOTS) {
+            m_summary.emplace_back(0);
+          }
+          m_raised.emplace_back();
         } catch(...) {
           m_children.pop_back();
           throw;
@@ -206,53 +215,88 @@ namespace Aspen {
       m_children[index].emplace(std::forward<decltype(reactor)>(reactor));
       m_free.pop_back();
     }
+    auto word = index / SLOTS;
     m_children[index]->m_reactor.set_slot(
-      &m_raised[index / BITS], static_cast<std::uint8_t>(index % BITS));
+      &m_raised[word].m_bits, static_cast<std::uint8_t>(index % SLOTS),
+      &m_summary[word / BITS], static_cast<std::uint8_t>(word % BITS));
     if(m_count == 0) {
       m_position = index;
     }
     ++m_count;
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  void Concur<T>::remove(std::size_t index) noexcept {
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  void Concur<T, L>::remove(std::size_t index) noexcept {
     clear_slot(index);
     m_children[index].reset();
     m_free.push_back(index);
     --m_count;
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  void Concur<T>::raise_slot(std::size_t index) noexcept {
-    m_raised[index / BITS].fetch_or(
-      std::uint64_t(1) << (index % BITS), std::memory_order_acq_rel);
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  void Concur<T, L>::raise_slot(std::size_t index) noexcept {
+    auto word = index / SLOTS;
+    m_raised[word].m_bits.fetch_or(std::uint64_t(1) << (index % SLOTS));
+    m_summary[word / BITS].fetch_or(std::uint64_t(1) << (word % BITS));
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  void Concur<T>::clear_slot(std::size_t index) noexcept {
-    m_raised[index / BITS].fetch_and(
-      ~(std::uint64_t(1) << (index % BITS)), std::memory_order_acq_rel);
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  void Concur<T, L>::clear_slot(std::size_t index) noexcept {
+    m_raised[index / SLOTS].m_bits.fetch_and(
+      ~(std::uint64_t(1) << (index % SLOTS)));
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  std::size_t Concur<T>::next(std::size_t index) const noexcept {
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  std::size_t Concur<T, L>::next(std::size_t index) const noexcept {
     if(index + 1 == m_children.size()) {
       return 0;
     }
     return index + 1;
   }
 
-  template<IsReactor T> requires IsReactor<reactor_result_t<T>>
-  std::size_t Concur<T>::find_raised(
-      std::size_t from, std::size_t count) const noexcept {
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  std::size_t Concur<T, L>::next_raised_word(std::size_t word) noexcept {
+    while(word < m_raised.size()) {
+      auto& summary = m_summary[word / BITS];
+      auto words = summary.load(std::memory_order_acquire) >> (word % BITS);
+      if(words == 0) {
+        word = (word / BITS + 1) * BITS;
+        continue;
+      }
+      word += std::countr_zero(words);
+      if(m_raised[word].m_bits.load() != 0) {
+        return word;
+      }
+      auto mask = std::uint64_t(1) << (word % BITS);
+      summary.fetch_and(~mask);
+      if(m_raised[word].m_bits.load() != 0) {
+        summary.fetch_or(mask);
+        return word;
+      }
+      ++word;
+    }
+    return m_raised.size();
+  }
+
+  template<IsReactor T, typename L> requires IsReactor<reactor_result_t<T>>
+  std::size_t Concur<T, L>::find_raised(
+      std::size_t from, std::size_t count) noexcept {
     auto slots = m_children.size();
     auto i = std::size_t(0);
     while(i < count) {
       auto index = (from + i) % slots;
-      auto bit = index % BITS;
-      auto span = std::min(BITS - bit, slots - index);
-      auto bits = m_raised[index / BITS].load(std::memory_order_acquire) >> bit;
-      if(span != BITS - bit) {
+      auto bit = index % SLOTS;
+      if(bit == 0) {
+        auto word = next_raised_word(index / SLOTS);
+        auto skipped = std::min(word * SLOTS, slots) - index;
+        if(skipped != 0) {
+          i += skipped;
+          continue;
+        }
+      }
+      auto span = std::min(SLOTS - bit, slots - index);
+      auto bits = m_raised[index / SLOTS].m_bits.load() >> bit;
+      if(span != SLOTS - bit) {
         bits &= (std::uint64_t(1) << span) - 1;
       }
       while(bits != 0) {
@@ -0,0 +1,275 @@
+#ifndef ASPEN_CONFLATING_QUEUE_HPP
+#define ASPEN_CONFLATING_QUEUE_HPP
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Traits.hpp"
+
+namespace Aspen {
+
+  /** Specifies what a ConflatingQueue does when a new key would overflow it. */
+  enum class OverflowPolicy {
+
+    /** Drops the key that has been waiting the longest. */
+    DROP_OLDEST,
+
+    /** Drops the value being pushed. */
+    DROP_NEWEST
+  };
+
+  /**
+   * A reactor that evaluates to key/value pairs pushed to an internal queue,
+   * keeping only the latest value for each key. A key keeps the position of
+   * its first pending push, so keys are delivered in order of first arrival
+   * while the number of pending entries never exceeds the number of distinct
+   * keys, or a configured maximum depth.
+   * @param <K> The type of key to conflate values by.
+   * @param <V> The type of values to queue.
+   * @param <H> The hash function used on keys.
+   */
+  template<typename K, typename V, typename H = std::hash<K>>
+  class ConflatingQueue {
+    public:
+
+      /** The type of key to conflate values by. */
+      using Key = K;
+
+      /** The type of values to queue. */
+      using Value = V;
+
+      /** The type of key/value pair evaluated to. */
+      using Type = std::pair<Key, Value>;
+
+      /** Constructs an empty ConflatingQueue with no maximum depth. */
+      ConflatingQueue();
+
+      /**
+       * Constructs an empty ConflatingQueue.
+       * @param max_depth The maximum number of pending keys.
+       * @param policy What to do when a new key would exceed the
+       *        <i>max_depth</i>.
+       */
+      ConflatingQueue(std::size_t max_depth, OverflowPolicy policy);
+
+      ConflatingQueue(ConflatingQueue&& queue);
+
+      /** Returns the number of values dropped due to overflow. */
+      std::uint64_t get_drop_count() const;
+
+      /** Returns the number of values replaced by a later value. */
+      std::uint64_t get_conflation_count() const;
+
+      /**
+       * Pushes a value, replacing any pending value with the same key,
+       * ignored once complete.
+       * @param key The key to push the value under.
+       * @param value The value to push.
+       */
+      void push(Key key, Value value);
+
+      /** Brings this reactor to a completion state. */
+      void set_complete();
+
+      /**
+       * Sets an exception and brings this reactor to a completion state,
+       * ignored once complete. A null exception completes without one.
+       * @param exception The exception to throw.
+       */
+      void set_complete(std::exception_ptr exception);
+
+      /**
+       * Brings this reactor to a completion state by throwing an exception.
+       * @param exception The exception to throw.
+       */
+      template<std::derived_from<std::exception> E>
+      void set_complete(E exception);
+
+      State commit(std::uint64_t sequence) noexcept;
+      eval_result_t<Type> eval() const;
+
+    private:
+      mutable std::mutex m_mutex;
+      std::size_t m_max_depth;
+      OverflowPolicy m_policy;
+      bool m_is_complete;
+      std::deque<Type> m_entries;
+      std::unordered_map<Key, std::uint64_t, H> m_positions;
+      std::uint64_t m_head;
+      std::uint64_t m_drop_count;
+      std::uint64_t m_conflation_count;
+      std::exception_ptr m_exception;
+      CommitFlag* m_flag;
+      std::optional<Type> m_current;
+      std::exception_ptr m_current_exception;
+
+      Type pop_front();
+      ConflatingQueue(const ConflatingQueue&) = delete;
+      ConflatingQueue& operator =(const ConflatingQueue&) = delete;
+  };
+
+  template<typename K, typename V, typename H>
+  ConflatingQueue<K, V, H>::ConflatingQueue()
+    : ConflatingQueue(std::numeric_limits<std::size_t>::max(),
+        OverflowPolicy::DROP_OLDEST) {}
+
+  template<typename K, typename V, typename H>
+  ConflatingQueue<K, V, H>::ConflatingQueue(
+    std::size_t max_depth, OverflowPolicy policy)
+    : m_max_depth(max_depth),
+      m_policy(policy),
+      m_is_complete(false),
+      m_head(0),
+      m_drop_count(0),
+      m_conflation_count(0),
+      m_flag(nullptr) {}
+
+  template<typename K, typename V, typename H>
+  ConflatingQueue<K, V, H>::ConflatingQueue(ConflatingQueue&& queue)
+      : m_flag(nullptr) {
+    auto lock = std::lock_guard(queue.m_mutex);
+    m_max_depth = queue.m_max_depth;
+    m_policy = queue.m_policy;
+    m_is_complete = queue.m_is_complete;
+    m_entries = std::move(queue.m_entries);
+    m_positions = std::move(queue.m_positions);
+    m_head = queue.m_head;
+    m_drop_count = queue.m_drop_count;
+    m_conflation_count = queue.m_conflation_count;
+    m_exception = std::move(queue.m_exception);
+    m_current = std::move(queue.m_current);
+    m_current_exception = std::move(queue.m_current_exception);
+  }
+
+  template<typename K, typename V, typename H>
+  std::uint64_t ConflatingQueue<K, V, H>::get_drop_count() const {
+    auto lock = std::lock_guard(m_mutex);
+    return m_drop_count;
+  }
+
+  template<typename K, typename V, typename H>
+  std::uint64_t ConflatingQueue<K, V, H>::get_conflation_count() const {
+    auto lock = std::lock_guard(m_mutex);
+    return m_conflation_count;
+  }
+
+  template<typename K, typename V, typename H>
+  void ConflatingQueue<K, V, H>::push(Key key, Value value) {
+    auto discarded = std::optional<Type>();
+    auto flag = [&] () -> CommitFlag* {
+      auto lock = std::lock_guard(m_mutex);
+      if(m_is_complete) {
+        return nullptr;
+      }
+      if(auto i = m_positions.find(key); i != m_positions.end()) {
+        std::swap(m_entries[i->second - m_head].second, value);
+        ++m_conflation_count;
+        return nullptr;
+      }
+      if(m_entries.size() >= m_max_depth) {
+        ++m_drop_count;
+        if(m_policy == OverflowPolicy::DROP_NEWEST || m_max_depth == 0) {
+          return nullptr;
+        }
+        discarded.emplace(pop_front());
+      }
+      m_entries.emplace_back(key, std::move(value));
+      try {
+        m_positions.emplace(std::move(key), m_head + m_entries.size() - 1);
+      } catch(...) {
+        m_entries.pop_back();
+        throw;
+      }
+      return m_flag;
+    }();
+    if(flag) {
+      flag->raise();
+    }
+  }
+
+  template<typename K, typename V, typename H>
+  void ConflatingQueue<K, V, H>::set_complete() {
+    set_complete(std::exception_ptr());
+  }
+
+  template<typename K, typename V, typename H>
+  void ConflatingQueue<K, V, H>::set_complete(std::exception_ptr exception) {
+    auto flag = [&] () -> CommitFlag* {
+      auto lock = std::lock_guard(m_mutex);
+      if(m_is_complete) {
+        return nullptr;
+      }
+      m_is_complete = true;
+      m_exception = std::move(exception);
+      return m_flag;
+    }();
+    if(flag) {
+      flag->raise();
+    }
+  }
+
+  template<typename K, typename V, typename H>
+  template<std::derived_from<std::exception> E>
+  void ConflatingQueue<K, V, H>::set_complete(E exception) {
+    set_complete(std::make_exception_ptr(std::move(exception)));
+  }
+
+  template<typename K, typename V, typename H>
+  State ConflatingQueue<K, V, H>::commit(std::uint64_t sequence) noexcept {
+    auto discarded = std::optional<Type>();
+    auto lock = std::lock_guard(m_mutex);
+    m_flag = CommitFlag::get_current();
+    if(!m_entries.empty()) {
+      discarded.swap(m_current);
+      m_current.emplace(pop_front());
+      if(!m_entries.empty() || m_exception) {
+        return State::CONTINUE_EVALUATED;
+      } else if(m_is_complete) {
+        return State::COMPLETE_EVALUATED;
+      }
+      return State::EVALUATED;
+    } else if(m_exception) {
+      discarded.swap(m_current);
+      m_current_exception = std::move(m_exception);
+      m_exception = nullptr;
+      return State::COMPLETE_EVALUATED;
+    } else if(m_is_complete) {
+      return State::COMPLETE;
+    }
+    return State::NONE;
+  }
+
+  template<typename K, typename V, typename H>
+  eval_result_t<typename ConflatingQueue<K, V, H>::Type>
+      ConflatingQueue<K, V, H>::eval() const {
+    if(!m_current) {
+      if(!m_current_exception) {
+        throw std::runtime_error("Uninitialized.");
+      }
+      std::rethrow_exception(m_current_exception);
+    }
+    return *m_current;
+  }
+
+  template<typename K, typename V, typename H>
+  typename ConflatingQueue<K, V, H>::Type
+      ConflatingQueue<K, V, H>::pop_front() {
+    m_positions.erase(m_entries.front().first);
+    auto entry = std::move(m_entries.front());
+    m_entries.pop_front();
+    ++m_head;
+    return entry;
+  }
+}
+
+#endif
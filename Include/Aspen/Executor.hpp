@@ -1,10 +1,13 @@
 #ifndef ASPEN_EXECUTOR_HPP
 #define ASPEN_EXECUTOR_HPP
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
+#include <semaphore>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -15,23 +18,52 @@
 #endif
 #include "Aspen/Box.hpp"
 #include "Aspen/CommitFlag.hpp"
+#include "Aspen/Profiler.hpp"
 #include "Aspen/Reactor.hpp"
 #include "Aspen/State.hpp"
+#include "Aspen/Transaction.hpp"
 #include "Aspen/Trigger.hpp"
 
 namespace Aspen {
 
+  /** Specifies how an Executor waits for its reactor to be updated. */
+  enum class WaitStrategy {
+
+    /** Blocks on a condition variable. */
+    CONDITION_VARIABLE,
+
+    /** Polls continuously without ever giving up the processor. */
+    BUSY_SPIN,
+
+    /** Polls for a short while, then repeatedly yields the processor. */
+    SPIN_YIELD,
+
+    /** Polls for a short while, then blocks on a futex. */
+    SPIN_WAIT
+  };
+
   /** Provides a synchronized environment for running a single reactor. */
   class Executor {
     public:
 
       /**
-       * Constructs an Executor.
+       * Constructs an Executor that blocks on a condition variable.
        * @param reactor The reactor to execute.
        */
       template<typename R> requires IsReactor<std::remove_cvref_t<R>>
       explicit Executor(R&& reactor);
 
+      /**
+       * Constructs an Executor.
+       * @param reactor The reactor to execute.
+       * @param wait_strategy How to wait for the reactor to be updated.
+       */
+      template<typename R> requires IsReactor<std::remove_cvref_t<R>>
+      Executor(R&& reactor, WaitStrategy wait_strategy);
+
+      /** Returns how this executor waits for its reactor to be updated. */
+      WaitStrategy get_wait_strategy() const noexcept;
+
       /**
        * Repeatedly executes the reactor until it completes or no longer
        * requires an immediate commit.
@@ -41,6 +73,23 @@ namespace Aspen {
       /** Repeatedly executes the reactor until it completes. */
       void run_until_complete();
 
+      /**
+       * Repeatedly executes the reactor until it completes or a deadline
+       * passes.
+       * @param deadline The point in time to stop executing at.
+       * @return <code>true</code> iff the reactor completed.
+       */
+      bool run_until(std::chrono::steady_clock::time_point deadline);
+
+      /**
+       * Repeatedly executes the reactor until it completes or a duration
+       * elapses.
+       * @param duration The amount of time to execute for.
+       * @return <code>true</code> iff the reactor completed.
+       */
+      template<typename Rep, typename Period>
+      bool run_for(const std::chrono::duration<Rep, Period>& duration);
+
       /**
        * Permanently stops this executor, callable from any thread.
        * Any run in progress returns and no further run executes.
@@ -62,6 +111,8 @@ namespace Aspen {
         RunningScope& operator =(const RunningScope&) = delete;
       };
       static constexpr auto INTERRUPT_INTERVAL = std::chrono::seconds(1);
+      static constexpr auto SPIN_COUNT = std::uint64_t(4096);
+      static constexpr auto CLOCK_INTERVAL = std::uint64_t(64);
       static inline std::mutex m_abort_mutex;
       static inline std::vector<Executor*> m_running_executors;
       static inline std::atomic_uint64_t m_interrupts;
@@ -71,6 +122,9 @@ namespace Aspen {
 #endif
       std::mutex m_mutex;
       std::condition_variable m_update_condition;
+      std::counting_semaphore<> m_update_semaphore;
+      std::atomic_bool m_is_sleeping;
+      WaitStrategy m_wait_strategy;
       Trigger m_trigger;
       CommitFlag m_flag;
       std::uint64_t m_sequence;
@@ -81,6 +135,9 @@ namespace Aspen {
       bool m_has_continuation;
 
       void on_update();
+      void wake() noexcept;
+      void wait(std::chrono::steady_clock::time_point deadline);
+      bool is_ready() const noexcept;
       bool is_aborted() const noexcept;
       State commit();
 #if defined(_WIN32)
@@ -94,7 +151,14 @@ namespace Aspen {
 
   template<typename R> requires IsReactor<std::remove_cvref_t<R>>
   Executor::Executor(R&& reactor)
-      : m_trigger([this] { on_update(); }),
+    : Executor(std::forward<R>(reactor), WaitStrategy::CONDITION_VARIABLE) {}
+
+  template<typename R> requires IsReactor<std::remove_cvref_t<R>>
+  Executor::Executor(R&& reactor, WaitStrategy wait_strategy)
+      : m_update_semaphore(0),
+        m_is_sleeping(false),
+        m_wait_strategy(wait_strategy),
+        m_trigger([this] { on_update(); }),
         m_sequence(0),
         m_start_interrupts(0),
         m_reactor(std::forward<R>(reactor)),
@@ -104,6 +168,14 @@ namespace Aspen {
     m_flag.set_trigger(&m_trigger);
   }
 
+  inline WaitStrategy Executor::get_wait_strategy() const noexcept {
+    return m_wait_strategy;
+  }
+
+  inline bool Executor::is_ready() const noexcept {
+    return m_flag.is_raised() || is_aborted();
+  }
+
   inline bool Executor::is_aborted() const noexcept {
     return m_is_aborted.load(std::memory_order_acquire) ||
       m_interrupts.load(std::memory_order_acquire) != m_start_interrupts;
@@ -111,8 +183,11 @@ namespace Aspen {
 
   inline State Executor::commit() {
     m_flag.clear();
-    auto scope = CommitFlagScope(m_flag);
-    auto state = m_reactor.commit(m_sequence);
+    auto state = profile_commit(m_flag, m_reactor, [&] {
+      auto scope = CommitFlagScope(m_flag);
+      auto snapshot = TransactionSnapshot();
+      return m_reactor.commit(m_sequence);
+    });
     ++m_sequence;
     m_has_continuation = has_continuation(state);
     if(is_complete(state)) {
@@ -134,20 +209,82 @@ namespace Aspen {
   }
 
   inline void Executor::run_until_complete() {
+    run_until(std::chrono::steady_clock::time_point::max());
+  }
+
+  inline bool Executor::run_until(
+      std::chrono::steady_clock::time_point deadline) {
     if(m_is_complete) {
-      return;
+      return true;
     }
+    auto is_bounded = deadline != std::chrono::steady_clock::time_point::max();
     auto scope = RunningScope(*this);
     while(!is_aborted()) {
+      if(is_bounded && std::chrono::steady_clock::now() >= deadline) {
+        break;
+      }
       if(m_sequence != 0 && !m_has_continuation && !m_flag.is_raised()) {
-        auto lock = std::unique_lock(m_mutex);
-        while(!m_update_condition.wait_for(lock, INTERRUPT_INTERVAL, [&] {
-          return m_flag.is_raised() || is_aborted();
-        })) {}
+        wait(deadline);
       } else if(is_complete(commit())) {
         break;
       }
     }
+    return m_is_complete;
+  }
+
+  template<typename Rep, typename Period>
+  bool Executor::run_for(const std::chrono::duration<Rep, Period>& duration) {
+    return run_until(std::chrono::steady_clock::now() +
+      std::chrono::ceil<std::chrono::steady_clock::duration>(duration));
+  }
+
+  inline void Executor::wait(std::chrono::steady_clock::time_point deadline) {
+    auto interval_deadline = [&] {
+      return std::min(deadline,
+        std::chrono::steady_clock::now() + INTERRUPT_INTERVAL);
+    };
+    if(m_wait_strategy == WaitStrategy::CONDITION_VARIABLE) {
+      auto lock = std::unique_lock(m_mutex);
+      m_is_sleeping.store(true);
+      m_update_condition.wait_until(lock, interval_deadline(), [&] {
+        return is_ready();
+      });
+      m_is_sleeping.store(false);
+      return;
+    }
+    for(auto spins = std::uint64_t(1); !is_ready(); ++spins) {
+      if(spins % CLOCK_INTERVAL == 0 &&
+          std::chrono::steady_clock::now() >= deadline) {
+        return;
+      }
+      if(spins == SPIN_COUNT && m_wait_strategy != WaitStrategy::BUSY_SPIN) {
+        break;
+      }
+    }
+    if(m_wait_strategy == WaitStrategy::SPIN_YIELD) {
+      while(!is_ready() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+      }
+    } else if(m_wait_strategy == WaitStrategy::SPIN_WAIT) {
+      while(m_update_semaphore.try_acquire()) {}
+      m_is_sleeping.store(true);
+      if(!is_ready()) {
+        m_update_semaphore.try_acquire_until(interval_deadline());
+      }
+      m_is_sleeping.store(false);
+    }
+  }
+
+  inline void Executor::wake() noexcept {
+    if(!m_is_sleeping.load() || !m_is_sleeping.exchange(false)) {
+      return;
+    }
+    if(m_wait_strategy == WaitStrategy::CONDITION_VARIABLE) {
+      auto lock = std::lock_guard(m_mutex);
+      m_update_condition.notify_one();
+    } else {
+      m_update_semaphore.release();
+    }
   }
 
   inline Executor::RunningScope::RunningScope(Executor& executor)
@@ -196,11 +333,11 @@ namespace Aspen {
       m_is_aborted.store(true, std::memory_order_release);
     }
     m_update_condition.notify_one();
+    m_update_semaphore.release();
   }
 
   inline void Executor::on_update() {
-    auto lock = std::lock_guard(m_mutex);
-    m_update_condition.notify_one();
+    wake();
   }
 
 #if defined(_WIN32)
@@ -0,0 +1,302 @@
+#ifndef ASPEN_GRAPH_ARENA_HPP
+#define ASPEN_GRAPH_ARENA_HPP
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "Aspen/Python/DllExports.hpp"
+
+namespace Aspen {
+  class GraphArena;
+
+namespace Details {
+  struct ASPEN_EXPORT_DLL StaticGraphArena {
+    static GraphArena*& get() noexcept;
+  };
+
+#ifndef ASPEN_USE_DLL
+  ASPEN_EMIT_DLL inline GraphArena*& StaticGraphArena::get() noexcept {
+    static thread_local auto current_arena = static_cast<GraphArena*>(nullptr);
+    return current_arena;
+  }
+#endif
+}
+
+  /**
+   * Allocates the nodes of a reactor graph contiguously out of large blocks
+   * that are all released at once when the arena is destroyed. Box and Shared
+   * allocate from the arena installed by a GraphArenaScope on the constructing
+   * thread, so the arena must outlive every reactor built within its scope.
+   * An arena is not thread-safe, only one thread may allocate from it at a
+   * time.
+   */
+  class GraphArena {
+    public:
+
+      /** The default size of each block of memory. */
+      static constexpr auto DEFAULT_BLOCK_SIZE = std::size_t(64 * 1024);
+
+      /** Returns the arena installed on the current thread, if any. */
+      static GraphArena* get_current() noexcept;
+
+      /** Constructs a GraphArena using the default block size. */
+      GraphArena();
+
+      /**
+       * Constructs a GraphArena.
+       * @param block_size The size of each block of memory to allocate.
+       */
+      explicit GraphArena(std::size_t block_size);
+
+      /** Returns the total number of bytes reserved by this arena. */
+      std::size_t get_capacity() const noexcept;
+
+      /** Returns the number of bytes handed out by this arena. */
+      std::size_t get_size() const noexcept;
+
+      /**
+       * Allocates memory from this arena.
+       * @param size The number of bytes to allocate.
+       * @param alignment The alignment of the memory.
+       * @return A pointer to the allocated memory.
+       */
+      void* allocate(std::size_t size, std::size_t alignment);
+
+      /**
+       * Returns memory to this arena, only reclaimed if it was the most recent
+       * allocation.
+       * @param pointer The memory to return.
+       * @param size The number of bytes that were allocated.
+       */
+      void deallocate(void* pointer, std::size_t size) noexcept;
+
+    private:
+      struct Block {
+        std::unique_ptr<std::byte[]> m_data;
+        std::size_t m_size;
+      };
+      std::size_t m_block_size;
+      std::vector<Block> m_blocks;
+      std::byte* m_position;
+      std::byte* m_end;
+      std::size_t m_size;
+
+      GraphArena(const GraphArena&) = delete;
+      GraphArena& operator =(const GraphArena&) = delete;
+  };
+
+  /** Installs a GraphArena on the current thread for the duration of scope. */
+  class GraphArenaScope {
+    public:
+
+      /**
+       * Constructs a GraphArenaScope.
+       * @param arena The arena to allocate from, or <code>nullptr</code> to
+       *        allocate from the heap for the duration of this scope.
+       */
+      explicit GraphArenaScope(GraphArena* arena) noexcept;
+
+      /**
+       * Constructs a GraphArenaScope.
+       * @param arena The arena to allocate from for the duration of this scope.
+       */
+      explicit GraphArenaScope(GraphArena& arena) noexcept;
+
+      ~GraphArenaScope();
+
+    private:
+      GraphArena* m_previous;
+
+      GraphArenaScope(const GraphArenaScope&) = delete;
+      GraphArenaScope& operator =(const GraphArenaScope&) = delete;
+  };
+
+  /**
+   * A standard allocator that allocates from a GraphArena, or from the heap
+   * when no arena is given. Deallocating arena memory is a no-op, since it
+   * may run on whichever thread releases the last reference to an object
+   * while the owning thread is still allocating.
+   * @param <T> The type of object to allocate.
+   */
+  template<typename T>
+  class ArenaAllocator {
+    public:
+
+      /** The type of object to allocate. */
+      using value_type = T;
+
+      /**
+       * Constructs an ArenaAllocator.
+       * @param arena The arena to allocate from, or <code>nullptr</code> to
+       *        allocate from the heap.
+       */
+      explicit ArenaAllocator(GraphArena* arena) noexcept;
+
+      template<typename U>
+      ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept;
+
+      /** Returns the arena allocated from. */
+      GraphArena* get_arena() const noexcept;
+
+      T* allocate(std::size_t count);
+      void deallocate(T* pointer, std::size_t count) noexcept;
+
+      template<typename U>
+      bool operator ==(const ArenaAllocator<U>& allocator) const noexcept;
+
+    private:
+      GraphArena* m_arena;
+  };
+
+namespace Details {
+  struct ArenaDeleter {
+    GraphArena* m_arena;
+
+    ArenaDeleter() noexcept
+      : m_arena(nullptr) {}
+
+    explicit ArenaDeleter(GraphArena* arena) noexcept
+      : m_arena(arena) {}
+
+    template<typename T>
+    void operator ()(T* pointer) const noexcept {
+      if(m_arena) {
+        pointer->~T();
+      } else {
+        delete pointer;
+      }
+    }
+  };
+
+  template<typename T>
+  using arena_ptr = std::unique_ptr<T, ArenaDeleter>;
+
+  template<typename T, typename... A>
+  arena_ptr<T> make_arena_unique(A&&... args) {
+    auto arena = GraphArena::get_current();
+    if(!arena) {
+      return arena_ptr<T>(new T(std::forward<A>(args)...), ArenaDeleter());
+    }
+    auto memory = arena->allocate(sizeof(T), alignof(T));
+    try {
+      return arena_ptr<T>(
+        ::new(memory) T(std::forward<A>(args)...), ArenaDeleter(arena));
+    } catch(...) {
+      arena->deallocate(memory, sizeof(T));
+      throw;
+    }
+  }
+
+  template<typename T, typename... A>
+  std::shared_ptr<T> make_arena_shared(A&&... args) {
+    if(auto arena = GraphArena::get_current()) {
+      return std::allocate_shared<T>(
+        ArenaAllocator<T>(arena), std::forward<A>(args)...);
+    }
+    return std::make_shared<T>(std::forward<A>(args)...);
+  }
+}
+
+  inline GraphArena* GraphArena::get_current() noexcept {
+    return Details::StaticGraphArena::get();
+  }
+
+  inline GraphArena::GraphArena()
+    : GraphArena(DEFAULT_BLOCK_SIZE) {}
+
+  inline GraphArena::GraphArena(std::size_t block_size)
+    : m_block_size(std::max(block_size, sizeof(std::max_align_t))),
+      m_position(nullptr),
+      m_end(nullptr),
+      m_size(0) {}
+
+  inline std::size_t GraphArena::get_capacity() const noexcept {
+    auto capacity = std::size_t(0);
+    for(auto& block : m_blocks) {
+      capacity += block.m_size;
+    }
+    return capacity;
+  }
+
+  inline std::size_t GraphArena::get_size() const noexcept {
+    return m_size;
+  }
+
+  inline void* GraphArena::allocate(std::size_t size, std::size_t alignment) {
+    auto space = static_cast<std::size_t>(m_end - m_position);
+    auto pointer = static_cast<void*>(m_position);
+    if(!m_position || !std::align(alignment, size, pointer, space)) {
+      auto block_size = std::max(m_block_size, size + alignment);
+      auto& block = m_blocks.emplace_back();
+      block.m_data = std::make_unique_for_overwrite<std::byte[]>(block_size);
+      block.m_size = block_size;
+      m_position = block.m_data.get();
+      m_end = m_position + block_size;
+      space = block_size;
+      pointer = m_position;
+      std::align(alignment, size, pointer, space);
+    }
+    m_position = static_cast<std::byte*>(pointer) + size;
+    m_size += size;
+    return pointer;
+  }
+
+  inline void GraphArena::deallocate(void* pointer, std::size_t size) noexcept {
+    if(static_cast<std::byte*>(pointer) + size == m_position) {
+      m_position = static_cast<std::byte*>(pointer);
+      m_size -= size;
+    }
+  }
+
+  inline GraphArenaScope::GraphArenaScope(GraphArena* arena) noexcept
+      : m_previous(Details::StaticGraphArena::get()) {
+    Details::StaticGraphArena::get() = arena;
+  }
+
+  inline GraphArenaScope::GraphArenaScope(GraphArena& arena) noexcept
+    : GraphArenaScope(&arena) {}
+
+  inline GraphArenaScope::~GraphArenaScope() {
+    Details::StaticGraphArena::get() = m_previous;
+  }
+
+  template<typename T>
+  ArenaAllocator<T>::ArenaAllocator(GraphArena* arena) noexcept
+    : m_arena(arena) {}
+
+  template<typename T>
+  template<typename U>
+  ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& allocator) noexcept
+    : m_arena(allocator.get_arena()) {}
+
+  template<typename T>
+  GraphArena* ArenaAllocator<T>::get_arena() const noexcept {
+    return m_arena;
+  }
+
+  template<typename T>
+  T* ArenaAllocator<T>::allocate(std::size_t count) {
+    if(m_arena) {
+      return static_cast<T*>(m_arena->allocate(sizeof(T) * count, alignof(T)));
+    }
+    return std::allocator<T>().allocate(count);
+  }
+
+  template<typename T>
+  void ArenaAllocator<T>::deallocate(T* pointer, std::size_t count) noexcept {
+    if(!m_arena) {
+      std::allocator<T>().deallocate(pointer, count);
+    }
+  }
+
+  template<typename T>
+  template<typename U>
+  bool ArenaAllocator<T>::operator ==(
+      const ArenaAllocator<U>& allocator) const noexcept {
+    return m_arena == allocator.get_arena();
+  }
+}
+
+#endif
@@ -351,6 +351,12 @@ namespace Details {
         std::constructible_from<F, FF>
       Lift(FF&& function, AF&& argument, AR&&... arguments);
 
+      /**
+       * Returns the exception thrown by the most recent application of the
+       * function, or nullptr for none.
+       */
+      std::exception_ptr get_exception() const noexcept;
+
       State commit(std::uint64_t sequence) noexcept;
       eval_result_t<Type> eval() const noexcept(is_noexcept);
 
@@ -388,6 +394,12 @@ namespace Details {
       template<typename FF> requires std::constructible_from<F, FF>
       explicit Lift(FF&& function);
 
+      /**
+       * Returns the exception thrown by the most recent application of the
+       * function, or nullptr for none.
+       */
+      std::exception_ptr get_exception() const noexcept;
+
       State commit(std::uint64_t sequence) noexcept;
       eval_result_t<Type> eval() const noexcept(is_noexcept);
 
@@ -654,6 +666,16 @@ namespace Details {
     return state;
   }
 
+  template<typename F, IsReactor... A> requires
+    std::invocable<F, Details::lift_argument_t<A>...>
+  std::exception_ptr Lift<F, A...>::get_exception() const noexcept {
+    if constexpr(requires { { m_value.get_exception() } noexcept; }) {
+      return m_value.get_exception();
+    } else {
+      return nullptr;
+    }
+  }
+
   template<typename F, IsReactor... A> requires
     std::invocable<F, Details::lift_argument_t<A>...>
   eval_result_t<typename Lift<F, A...>::Type> Lift<F, A...>::eval() const
@@ -698,6 +720,15 @@ namespace Details {
     return State::COMPLETE;
   }
 
+  template<std::invocable F>
+  std::exception_ptr Lift<F>::get_exception() const noexcept {
+    if constexpr(requires { { m_value.get_exception() } noexcept; }) {
+      return m_value.get_exception();
+    } else {
+      return nullptr;
+    }
+  }
+
   template<std::invocable F>
   eval_result_t<typename Lift<F>::Type> Lift<F>::eval() const
       noexcept(is_noexcept) {
@@ -0,0 +1,200 @@
+#ifndef ASPEN_LOCK_FREE_CELL_HPP
+#define ASPEN_LOCK_FREE_CELL_HPP
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/SlotLayout.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Traits.hpp"
+
+namespace Aspen {
+
+  /**
+   * A reactor that evaluates to the most recently set value, updated by a
+   * single writing thread without taking a lock. Values are exchanged through
+   * a triple buffer, so setting a value is a single atomic exchange and
+   * evaluating it is a plain read. The CommitFlag is only raised when the
+   * previous value has already been committed.
+   * @param <T> The type to evaluate to.
+   */
+  template<typename T>
+  class LockFreeCell {
+    public:
+
+      /** The type to evaluate to. */
+      using Type = T;
+
+      /** Constructs a LockFreeCell with no initial value. */
+      LockFreeCell() noexcept;
+
+      /**
+       * Constructs a LockFreeCell with an initial value.
+       * @param value The initial value to evaluate to.
+       */
+      explicit LockFreeCell(Type value) noexcept(
+        std::is_nothrow_move_constructible_v<Type>);
+
+      /**
+       * Moves a cell, which must not be performed concurrently with any other
+       * operation on either cell.
+       */
+      LockFreeCell(LockFreeCell&& cell) noexcept(
+        std::is_nothrow_move_constructible_v<Type>);
+
+      /**
+       * Sets the value to evaluate to, ignored once complete. Only one thread
+       * may update the cell at a time.
+       * @param value The value this reactor should evaluate to.
+       */
+      void set(Type value);
+
+      /** Brings this reactor to a completion state. */
+      void set_complete();
+
+      /**
+       * Sets the value to evaluate to and brings this reactor to a completion
+       * state.
+       * @param value The value to evaluate to.
+       */
+      void set_complete(Type value);
+
+      State commit(std::uint64_t sequence) noexcept;
+      eval_result_t<Type> eval() const;
+
+    private:
+      static constexpr auto INDEX = std::uint8_t(3);
+      static constexpr auto FRESH = std::uint8_t(4);
+      static constexpr auto COMPLETE = std::uint8_t(8);
+      struct alignas(CACHE_LINE_SIZE) Slot {
+        std::optional<Type> m_value;
+      };
+      Slot m_slots[3];
+      alignas(CACHE_LINE_SIZE) std::atomic_uint8_t m_middle;
+      std::atomic<CommitFlag*> m_flag;
+      alignas(CACHE_LINE_SIZE) std::uint8_t m_back;
+      bool m_is_complete;
+      alignas(CACHE_LINE_SIZE) std::uint8_t m_front;
+      bool m_is_terminated;
+
+      void publish(std::uint8_t bits) noexcept;
+      LockFreeCell(const LockFreeCell&) = delete;
+      LockFreeCell& operator =(const LockFreeCell&) = delete;
+  };
+
+  template<typename T>
+  LockFreeCell<T>::LockFreeCell() noexcept
+    : m_middle(1),
+      m_flag(nullptr),
+      m_back(2),
+      m_is_complete(false),
+      m_front(0),
+      m_is_terminated(false) {}
+
+  template<typename T>
+  LockFreeCell<T>::LockFreeCell(Type value) noexcept(
+      std::is_nothrow_move_constructible_v<Type>)
+      : LockFreeCell() {
+    m_slots[1].m_value.emplace(std::move(value));
+    m_middle.store(1 | FRESH, std::memory_order_relaxed);
+  }
+
+  template<typename T>
+  LockFreeCell<T>::LockFreeCell(LockFreeCell&& cell) noexcept(
+      std::is_nothrow_move_constructible_v<Type>)
+      : m_middle(cell.m_middle.load()),
+        m_flag(nullptr),
+        m_back(cell.m_back),
+        m_is_complete(cell.m_is_complete),
+        m_front(cell.m_front),
+        m_is_terminated(cell.m_is_terminated) {
+    for(auto i = 0; i != 3; ++i) {
+      m_slots[i].m_value = std::move(cell.m_slots[i].m_value);
+    }
+  }
+
+  template<typename T>
+  void LockFreeCell<T>::set(Type value) {
+    if(m_is_complete) {
+      return;
+    }
+    m_slots[m_back].m_value = std::move(value);
+    publish(FRESH);
+  }
+
+  template<typename T>
+  void LockFreeCell<T>::set_complete() {
+    if(m_is_complete) {
+      return;
+    }
+    m_is_complete = true;
+    auto previous = m_middle.fetch_or(COMPLETE);
+    if(!(previous & FRESH)) {
+      if(auto flag = m_flag.load()) {
+        flag->raise();
+      }
+    }
+  }
+
+  template<typename T>
+  void LockFreeCell<T>::set_complete(Type value) {
+    if(m_is_complete) {
+      return;
+    }
+    m_slots[m_back].m_value = std::move(value);
+    m_is_complete = true;
+    publish(FRESH | COMPLETE);
+  }
+
+  template<typename T>
+  State LockFreeCell<T>::commit(std::uint64_t sequence) noexcept {
+    auto flag = CommitFlag::get_current();
+    if(m_flag.load(std::memory_order_relaxed) != flag) {
+      m_flag.store(flag);
+    }
+    if(m_is_terminated) {
+      return State::COMPLETE;
+    }
+    auto middle = m_middle.load();
+    if(!(middle & (FRESH | COMPLETE))) {
+      return State::NONE;
+    }
+    auto state = State::NONE;
+    if(middle & FRESH) {
+      middle = m_middle.exchange(m_front);
+      m_front = middle & INDEX;
+      state = State::EVALUATED;
+    }
+    if(middle & COMPLETE) {
+      m_is_terminated = true;
+      state = combine(state, State::COMPLETE);
+    }
+    return state;
+  }
+
+  template<typename T>
+  eval_result_t<typename LockFreeCell<T>::Type>
+      LockFreeCell<T>::eval() const {
+    auto& value = m_slots[m_front].m_value;
+    if(!value) {
+      throw std::runtime_error("Uninitialized.");
+    }
+    return *value;
+  }
+
+  template<typename T>
+  void LockFreeCell<T>::publish(std::uint8_t bits) noexcept {
+    auto previous = m_middle.exchange(m_back | bits);
+    m_back = previous & INDEX;
+    if(!(previous & FRESH)) {
+      if(auto flag = m_flag.load()) {
+        flag->raise();
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,283 @@
+#ifndef ASPEN_LOCK_FREE_QUEUE_HPP
+#define ASPEN_LOCK_FREE_QUEUE_HPP
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Traits.hpp"
+
+namespace Aspen {
+
+  /**
+   * A reactor that evaluates to the values pushed to an internal queue, where
+   * any number of threads may push without taking a lock. Only the thread
+   * committing the reactor consumes values, and the CommitFlag is only raised
+   * when the queue goes from empty to non-empty.
+   * @param <T> The type of values to queue.
+   */
+  template<typename T>
+  class LockFreeQueue {
+    public:
+
+      /** The type of values to queue. */
+      using Type = T;
+
+      /** Constructs an empty LockFreeQueue. */
+      LockFreeQueue();
+
+      /**
+       * Moves a queue, which must not be performed concurrently with any
+       * other operation on either queue.
+       */
+      LockFreeQueue(LockFreeQueue&& queue);
+
+      ~LockFreeQueue();
+
+      /**
+       * Pushes a value to the queue, ignored once complete.
+       * @param value The value to push.
+       */
+      void push(Type value);
+
+      /** Brings this reactor to a completion state. */
+      void set_complete();
+
+      /**
+       * Pushes a value and brings this reactor to a completion state.
+       * @param value The value to push.
+       */
+      void set_complete(Type value);
+
+      /**
+       * Sets an exception and brings this reactor to a completion state,
+       * ignored once complete. A null exception completes without one.
+       * @param exception The exception to throw.
+       */
+      void set_complete(std::exception_ptr exception);
+
+      /**
+       * Brings this reactor to a completion state by throwing an exception.
+       * @param exception The exception to throw.
+       */
+      template<std::derived_from<std::exception> E>
+      void set_complete(E exception);
+
+      State commit(std::uint64_t sequence) noexcept;
+      eval_result_t<Type> eval() const;
+
+    private:
+      struct Node {
+        std::atomic<Node*> m_next;
+        std::optional<Type> m_value;
+        std::exception_ptr m_exception;
+        bool m_is_complete;
+
+        Node() noexcept;
+      };
+      std::atomic<Node*> m_head;
+      Node* m_tail;
+      std::atomic_bool m_is_waiting;
+      std::atomic_bool m_is_complete;
+      std::atomic<CommitFlag*> m_flag;
+      std::optional<Type> m_current;
+      std::exception_ptr m_exception;
+      bool m_is_terminated;
+
+      void enqueue(Node* node) noexcept;
+      Node* peek() const noexcept;
+      Node* pop() noexcept;
+      bool wait() noexcept;
+      LockFreeQueue(const LockFreeQueue&) = delete;
+      LockFreeQueue& operator =(const LockFreeQueue&) = delete;
+  };
+
+  template<typename T>
+  LockFreeQueue<T>::Node::Node() noexcept
+    : m_next(nullptr),
+      m_is_complete(false) {}
+
+  template<typename T>
+  LockFreeQueue<T>::LockFreeQueue()
+    : m_head(new Node()),
+      m_tail(m_head.load(std::memory_order_relaxed)),
+      m_is_waiting(false),
+      m_is_complete(false),
+      m_flag(nullptr),
+      m_is_terminated(false) {}
+
+  template<typename T>
+  LockFreeQueue<T>::LockFreeQueue(LockFreeQueue&& queue)
+      : m_head(queue.m_head.load()),
+        m_tail(queue.m_tail),
+        m_is_waiting(false),
+        m_is_complete(queue.m_is_complete.load()),
+        m_flag(nullptr),
+        m_current(std::move(queue.m_current)),
+        m_exception(std::move(queue.m_exception)),
+        m_is_terminated(queue.m_is_terminated) {
+    auto stub = new Node();
+    queue.m_head.store(stub);
+    queue.m_tail = stub;
+  }
+
+  template<typename T>
+  LockFreeQueue<T>::~LockFreeQueue() {
+    auto node = m_tail;
+    while(node) {
+      auto next = node->m_next.load(std::memory_order_relaxed);
+      delete node;
+      node = next;
+    }
+  }
+
+  template<typename T>
+  void LockFreeQueue<T>::push(Type value) {
+    if(m_is_complete.load(std::memory_order_acquire)) {
+      return;
+    }
+    auto node = new Node();
+    try {
+      node->m_value.emplace(std::move(value));
+    } catch(...) {
+      delete node;
+      throw;
+    }
+    enqueue(node);
+  }
+
+  template<typename T>
+  void LockFreeQueue<T>::set_complete() {
+    set_complete(std::exception_ptr());
+  }
+
+  template<typename T>
+  void LockFreeQueue<T>::set_complete(Type value) {
+    if(m_is_complete.load(std::memory_order_acquire)) {
+      return;
+    }
+    auto node = new Node();
+    try {
+      node->m_value.emplace(std::move(value));
+    } catch(...) {
+      delete node;
+      throw;
+    }
+    if(m_is_complete.exchange(true, std::memory_order_acq_rel)) {
+      delete node;
+      return;
+    }
+    node->m_is_complete = true;
+    enqueue(node);
+  }
+
+  template<typename T>
+  void LockFreeQueue<T>::set_complete(std::exception_ptr exception) {
+    if(m_is_complete.exchange(true, std::memory_order_acq_rel)) {
+      return;
+    }
+    auto node = new Node();
+    node->m_exception = std::move(exception);
+    node->m_is_complete = true;
+    enqueue(node);
+  }
+
+  template<typename T>
+  template<std::derived_from<std::exception> E>
+  void LockFreeQueue<T>::set_complete(E exception) {
+    set_complete(std::make_exception_ptr(std::move(exception)));
+  }
+
+  template<typename T>
+  State LockFreeQueue<T>::commit(std::uint64_t sequence) noexcept {
+    m_flag.store(CommitFlag::get_current());
+    if(m_is_terminated) {
+      return State::COMPLETE;
+    }
+    auto node = pop();
+    if(!node) {
+      if(wait()) {
+        return State::NONE;
+      }
+      return State::CONTINUE;
+    }
+    if(!node->m_value) {
+      m_is_terminated = true;
+      if(node->m_exception) {
+        m_current = std::nullopt;
+        m_exception = std::move(node->m_exception);
+        return State::COMPLETE_EVALUATED;
+      }
+      return State::COMPLETE;
+    }
+    m_current = std::move(node->m_value);
+    node->m_value = std::nullopt;
+    if(node->m_is_complete) {
+      m_is_terminated = true;
+      return State::COMPLETE_EVALUATED;
+    }
+    if(auto next = peek()) {
+      if(next->m_is_complete && !next->m_value && !next->m_exception) {
+        pop();
+        m_is_terminated = true;
+        return State::COMPLETE_EVALUATED;
+      }
+      return State::CONTINUE_EVALUATED;
+    } else if(!wait()) {
+      return State::CONTINUE_EVALUATED;
+    }
+    return State::EVALUATED;
+  }
+
+  template<typename T>
+  eval_result_t<typename LockFreeQueue<T>::Type>
+      LockFreeQueue<T>::eval() const {
+    if(!m_current) {
+      if(!m_exception) {
+        throw std::runtime_error("Uninitialized.");
+      }
+      std::rethrow_exception(m_exception);
+    }
+    return *m_current;
+  }
+
+  template<typename T>
+  void LockFreeQueue<T>::enqueue(Node* node) noexcept {
+    auto previous = m_head.exchange(node, std::memory_order_acq_rel);
+    previous->m_next.store(node, std::memory_order_release);
+    if(m_is_waiting.load() && m_is_waiting.exchange(false)) {
+      if(auto flag = m_flag.load()) {
+        flag->raise();
+      }
+    }
+  }
+
+  template<typename T>
+  typename LockFreeQueue<T>::Node* LockFreeQueue<T>::peek() const noexcept {
+    return m_tail->m_next.load(std::memory_order_acquire);
+  }
+
+  template<typename T>
+  typename LockFreeQueue<T>::Node* LockFreeQueue<T>::pop() noexcept {
+    auto next = peek();
+    if(!next) {
+      return nullptr;
+    }
+    delete m_tail;
+    m_tail = next;
+    return next;
+  }
+
+  template<typename T>
+  bool LockFreeQueue<T>::wait() noexcept {
+    m_is_waiting.store(true);
+    return m_head.load() == m_tail;
+  }
+}
+
+#endif
@@ -0,0 +1,380 @@
+#ifndef ASPEN_PROFILER_HPP
+#define ASPEN_PROFILER_HPP
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <exception>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#ifdef ASPEN_ENABLE_PROFILER
+  #include <algorithm>
+  #include <cstdlib>
+  #include <iomanip>
+  #include <memory>
+  #include <mutex>
+  #include <typeinfo>
+  #include <unordered_map>
+  #include <unordered_set>
+  #if defined(__GNUG__)
+    #include <cxxabi.h>
+  #endif
+#endif
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Python/DllExports.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Traits.hpp"
+
+namespace Aspen {
+
+  /** Specifies how a profile is laid out when printed. */
+  enum class ProfileLayout {
+
+    /** Lists every node ordered by the time spent in its own commit. */
+    FLAT,
+
+    /** Lists every node beneath the node that committed it. */
+    HIERARCHICAL
+  };
+
+  /** Stores the statistics profiled for a single node of a reactor graph. */
+  struct ProfileRecord {
+
+    /**
+     * Identifies the node, assigned to the CommitFlag it is committed within
+     * and never reused by another flag.
+     */
+    std::uint64_t m_id;
+
+    /** The id of the node that committed this node, or 0 for a root. */
+    std::uint64_t m_parent;
+
+    /** The name of the node's type. */
+    std::string m_name;
+
+    /** The number of times the node was committed. */
+    std::uint64_t m_commits;
+
+    /** The number of commits that produced an evaluation. */
+    std::uint64_t m_evaluations;
+
+    /**
+     * The number of evaluations that resulted in an exception, counted for
+     * reactors reporting their exception through get_exception.
+     */
+    std::uint64_t m_exceptions;
+
+    /** The total time spent committing the node, including its children. */
+    std::chrono::nanoseconds m_total_time;
+
+    /** The total time spent committing the node, excluding its children. */
+    std::chrono::nanoseconds m_self_time;
+
+    /** The longest time spent in a single commit. */
+    std::chrono::nanoseconds m_max_time;
+  };
+
+  /**
+   * Whether reactor commits are profiled, enabled by building with
+   * <code>ASPEN_ENABLE_PROFILER</code> defined.
+   */
+#ifdef ASPEN_ENABLE_PROFILER
+  inline constexpr auto is_profiler_enabled = true;
+#else
+  inline constexpr auto is_profiler_enabled = false;
+#endif
+
+  /**
+   * Commits a reactor, recording its statistics when profiling is enabled.
+   * The parent of the node is the CommitFlag current at the time of the call.
+   * The reactor is never evaluated, so exceptions are only counted for
+   * reactors exposing them through get_exception.
+   * @param flag The CommitFlag the <i>reactor</i> is committed within.
+   * @param reactor The reactor being committed.
+   * @param commit The callable performing the commit.
+   * @return The State returned by <i>commit</i>.
+   */
+  template<typename R, typename F>
+  State profile_commit(
+    const CommitFlag& flag, const R& reactor, F&& commit) noexcept;
+
+  /** Returns the statistics of every node profiled across all threads. */
+  std::vector<ProfileRecord> get_profile();
+
+  /** Discards all statistics profiled so far. */
+  void reset_profile();
+
+  /**
+   * Prints the statistics of every node profiled across all threads.
+   * @param sink The stream to print to.
+   * @param layout How to lay out the nodes.
+   */
+  void print_profile(std::ostream& sink, ProfileLayout layout);
+
+#ifdef ASPEN_ENABLE_PROFILER
+namespace Details {
+  struct ProfileEntry {
+    std::uint64_t m_parent;
+    const std::type_info* m_type;
+    std::uint64_t m_commits;
+    std::uint64_t m_evaluations;
+    std::uint64_t m_exceptions;
+    std::chrono::nanoseconds m_total_time;
+    std::chrono::nanoseconds m_max_time;
+  };
+
+  struct ProfileTable {
+    std::mutex m_mutex;
+    std::unordered_map<std::uint64_t, ProfileEntry> m_entries;
+  };
+
+  struct ProfileRegistry {
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<ProfileTable>> m_tables;
+  };
+
+  struct ASPEN_EXPORT_DLL StaticProfiler {
+    static ProfileRegistry& get_registry() noexcept;
+    static ProfileTable& get_table();
+    static std::atomic_uint64_t& get_next_id() noexcept;
+  };
+
+#ifndef ASPEN_USE_DLL
+  ASPEN_EMIT_DLL inline ProfileRegistry&
+      StaticProfiler::get_registry() noexcept {
+    static auto registry = ProfileRegistry();
+    return registry;
+  }
+
+  ASPEN_EMIT_DLL inline ProfileTable& StaticProfiler::get_table() {
+    static thread_local auto table = [] {
+      auto table = std::make_shared<ProfileTable>();
+      auto& registry = get_registry();
+      auto lock = std::lock_guard(registry.m_mutex);
+      registry.m_tables.push_back(table);
+      return table;
+    }();
+    return *table;
+  }
+
+  ASPEN_EMIT_DLL inline std::atomic_uint64_t&
+      StaticProfiler::get_next_id() noexcept {
+    static auto next_id = std::atomic_uint64_t(1);
+    return next_id;
+  }
+#endif
+
+  struct ProfileIds {
+    static std::uint64_t get(const CommitFlag* flag) noexcept {
+      if(!flag) {
+        return 0;
+      }
+      auto id = flag->m_profile_id.load(std::memory_order_relaxed);
+      if(id != 0) {
+        return id;
+      }
+      auto next = StaticProfiler::get_next_id().fetch_add(
+        1, std::memory_order_relaxed);
+      if(flag->m_profile_id.compare_exchange_strong(
+          id, next, std::memory_order_relaxed)) {
+        return next;
+      }
+      return id;
+    }
+  };
+
+  std::exception_ptr get_profiled_exception(const auto& reactor) noexcept {
+    if constexpr(requires {
+        { reactor.get_exception() } -> std::same_as<std::exception_ptr>;
+      }) {
+      return reactor.get_exception();
+    } else if constexpr(requires {
+        { reactor->get_exception() } -> std::same_as<std::exception_ptr>;
+      }) {
+      return reactor->get_exception();
+    } else {
+      return nullptr;
+    }
+  }
+
+  inline std::string demangle(const std::type_info& type) {
+#if defined(__GNUG__)
+    auto status = 0;
+    auto name = abi::__cxa_demangle(type.name(), nullptr, nullptr, &status);
+    if(status == 0 && name) {
+      auto result = std::string(name);
+      std::free(name);
+      return result;
+    }
+#endif
+    return type.name();
+  }
+
+  inline void print_profile_record(
+      std::ostream& sink, const ProfileRecord& record, int depth) {
+    auto to_microseconds = [] (std::chrono::nanoseconds duration) {
+      return std::chrono::duration<double, std::micro>(duration).count();
+    };
+    sink << std::setw(10) << record.m_commits << ' ' <<
+      std::setw(10) << record.m_evaluations << ' ' <<
+      std::setw(10) << record.m_exceptions << ' ' << std::fixed <<
+      std::setprecision(1) << std::setw(12) <<
+      to_microseconds(record.m_total_time) << ' ' << std::setw(12) <<
+      to_microseconds(record.m_self_time) << ' ' << std::setw(10) <<
+      to_microseconds(record.m_max_time) << ' ' <<
+      std::string(2 * depth, ' ') << record.m_name << " [" << record.m_id <<
+      "]\n";
+  }
+}
+#endif
+
+  template<typename R, typename F>
+  State profile_commit(
+      const CommitFlag& flag, const R& reactor, F&& commit) noexcept {
+#ifdef ASPEN_ENABLE_PROFILER
+    auto parent = CommitFlag::get_current();
+    auto start = std::chrono::steady_clock::now();
+    auto state = std::forward<F>(commit)();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start);
+    auto has_exception = has_evaluation(state) &&
+      Details::get_profiled_exception(reactor) != nullptr;
+    auto id = Details::ProfileIds::get(&flag);
+    auto parent_id = Details::ProfileIds::get(parent);
+    try {
+      auto& table = Details::StaticProfiler::get_table();
+      auto lock = std::lock_guard(table.m_mutex);
+      auto& entry = table.m_entries[id];
+      entry.m_parent = parent_id;
+      entry.m_type = &typeid(R);
+      ++entry.m_commits;
+      if(has_evaluation(state)) {
+        ++entry.m_evaluations;
+      }
+      if(has_exception) {
+        ++entry.m_exceptions;
+      }
+      entry.m_total_time += duration;
+      entry.m_max_time = std::max(entry.m_max_time, duration);
+    } catch(...) {}
+    return state;
+#else
+    return std::forward<F>(commit)();
+#endif
+  }
+
+  inline std::vector<ProfileRecord> get_profile() {
+#ifdef ASPEN_ENABLE_PROFILER
+    auto tables = [] {
+      auto& registry = Details::StaticProfiler::get_registry();
+      auto lock = std::lock_guard(registry.m_mutex);
+      return registry.m_tables;
+    }();
+    auto records = std::unordered_map<std::uint64_t, ProfileRecord>();
+    auto types = std::unordered_map<std::uint64_t, const std::type_info*>();
+    for(auto& table : tables) {
+      auto lock = std::lock_guard(table->m_mutex);
+      for(auto& [id, entry] : table->m_entries) {
+        auto& record = records[id];
+        record.m_id = id;
+        record.m_parent = entry.m_parent;
+        types[id] = entry.m_type;
+        record.m_commits += entry.m_commits;
+        record.m_evaluations += entry.m_evaluations;
+        record.m_exceptions += entry.m_exceptions;
+        record.m_total_time += entry.m_total_time;
+        record.m_max_time = std::max(record.m_max_time, entry.m_max_time);
+      }
+    }
+    for(auto& [id, record] : records) {
+      record.m_name = Details::demangle(*types[id]);
+      record.m_self_time += record.m_total_time;
+      if(record.m_parent != id) {
+        auto parent = records.find(record.m_parent);
+        if(parent != records.end()) {
+          parent->second.m_self_time -= record.m_total_time;
+        }
+      }
+    }
+    auto profile = std::vector<ProfileRecord>();
+    profile.reserve(records.size());
+    for(auto& record : records) {
+      profile.push_back(std::move(record.second));
+    }
+    std::sort(profile.begin(), profile.end(), [] (auto& left, auto& right) {
+      return left.m_self_time > right.m_self_time;
+    });
+    return profile;
+#else
+    return {};
+#endif
+  }
+
+  inline void reset_profile() {
+#ifdef ASPEN_ENABLE_PROFILER
+    auto& registry = Details::StaticProfiler::get_registry();
+    auto lock = std::lock_guard(registry.m_mutex);
+    for(auto& table : registry.m_tables) {
+      auto table_lock = std::lock_guard(table->m_mutex);
+      table->m_entries.clear();
+    }
+#endif
+  }
+
+  inline void print_profile(std::ostream& sink, ProfileLayout layout) {
+#ifdef ASPEN_ENABLE_PROFILER
+    auto profile = get_profile();
+    sink << "   commits evaluations exceptions     total_us      self_us" <<
+      "     max_us node\n";
+    if(layout == ProfileLayout::FLAT) {
+      for(auto& record : profile) {
+        Details::print_profile_record(sink, record, 0);
+      }
+      return;
+    }
+    auto indexes = std::unordered_map<std::uint64_t, std::size_t>();
+    for(auto i = std::size_t(0); i != profile.size(); ++i) {
+      indexes[profile[i].m_id] = i;
+    }
+    auto children = std::unordered_map<std::uint64_t,
+      std::vector<const ProfileRecord*>>();
+    auto roots = std::vector<const ProfileRecord*>();
+    for(auto& record : profile) {
+      if(record.m_parent == record.m_id ||
+          !indexes.contains(record.m_parent)) {
+        roots.push_back(&record);
+      } else {
+        children[record.m_parent].push_back(&record);
+      }
+    }
+    auto by_total_time = [] (auto left, auto right) {
+      return left->m_total_time > right->m_total_time;
+    };
+    std::sort(roots.begin(), roots.end(), by_total_time);
+    for(auto& siblings : children) {
+      std::sort(siblings.second.begin(), siblings.second.end(),
+        by_total_time);
+    }
+    auto visited = std::unordered_set<std::uint64_t>();
+    auto print = [&] (auto& self, const ProfileRecord& record, int depth) {
+      if(!visited.insert(record.m_id).second) {
+        return;
+      }
+      Details::print_profile_record(sink, record, depth);
+      auto siblings = children.find(record.m_id);
+      if(siblings != children.end()) {
+        for(auto child : siblings->second) {
+          self(self, *child, depth + 1);
+        }
+      }
+    };
+    for(auto root : roots) {
+      print(print, *root, 0);
+    }
+#endif
+  }
+}
+
+#endif
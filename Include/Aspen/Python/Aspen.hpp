@@ -37,6 +37,7 @@
 #include "Aspen/Python/Trigger.hpp"
 #include "Aspen/Python/Unconsecutive.hpp"
 #include "Aspen/Python/Until.hpp"
+#include "Aspen/Python/VectorSync.hpp"
 #include "Aspen/Python/When.hpp"
 
 #endif
@@ -8,7 +8,10 @@
 
 namespace Aspen {
 
-  /** Exports a SharedBox evaluating to a Python object. */
+  /**
+   * Exports the SharedBoxes evaluating to Python objects and to the native
+   * numeric types used by typed operators.
+   */
   void export_box(pybind11::module& module);
 
   /**
@@ -1,12 +1,81 @@
 #ifndef ASPEN_PYTHON_GIL_ACQUIRE_REACTOR_HPP
 #define ASPEN_PYTHON_GIL_ACQUIRE_REACTOR_HPP
 #include <cstdint>
+#include <optional>
+#include <utility>
 #include <pybind11/pybind11.h>
 #include <type_traits>
 #include "Aspen/LocalPtr.hpp"
 #include "Aspen/Traits.hpp"
+#include "Aspen/Python/DllExports.hpp"
 
 namespace Aspen {
+namespace Details {
+  struct ASPEN_EXPORT_DLL StaticGil {
+    static int& get_depth() noexcept;
+  };
+
+#ifndef ASPEN_USE_DLL
+  ASPEN_EMIT_DLL inline int& StaticGil::get_depth() noexcept {
+    static thread_local auto depth = 0;
+    return depth;
+  }
+#endif
+}
+
+  /** Specifies how often an Executor acquires the Python GIL. */
+  enum class GilPolicy {
+
+    /** The GIL is acquired and released around every commit. */
+    COMMIT,
+
+    /**
+     * The GIL is held across consecutive commits that have a continuation,
+     * and released once the reactor runs out of immediate work or the
+     * interpreter's switch interval elapses.
+     */
+    RUN
+  };
+
+  /**
+   * Acquires the Python GIL for the duration of a scope. Only the outermost
+   * GilAcquireScope on a thread acquires the GIL, nested scopes only count
+   * their depth.
+   */
+  class GilAcquireScope {
+    public:
+
+      /** Acquires the GIL unless an enclosing scope already holds it. */
+      GilAcquireScope();
+
+      ~GilAcquireScope();
+
+    private:
+      std::optional<pybind11::gil_scoped_acquire> m_lock;
+
+      GilAcquireScope(const GilAcquireScope&) = delete;
+      GilAcquireScope& operator =(const GilAcquireScope&) = delete;
+  };
+
+  /**
+   * Releases the Python GIL for the duration of a scope, suspending any
+   * GilAcquireScope active on the current thread.
+   */
+  class GilReleaseScope {
+    public:
+
+      /** Releases the GIL held by the current thread. */
+      GilReleaseScope();
+
+      ~GilReleaseScope();
+
+    private:
+      int m_depth;
+      pybind11::gil_scoped_release m_release;
+
+      GilReleaseScope(const GilReleaseScope&) = delete;
+      GilReleaseScope& operator =(const GilReleaseScope&) = delete;
+  };
 
   /**
    * Wraps a reactor ensuring that the Python GIL is acquired before performing
@@ -38,6 +107,25 @@ namespace Aspen {
   template<typename R>
   GilAcquireReactor(R&&) -> GilAcquireReactor<std::decay_t<R>>;
 
+  inline GilAcquireScope::GilAcquireScope() {
+    auto& depth = Details::StaticGil::get_depth();
+    if(depth == 0) {
+      m_lock.emplace();
+    }
+    ++depth;
+  }
+
+  inline GilAcquireScope::~GilAcquireScope() {
+    --Details::StaticGil::get_depth();
+  }
+
+  inline GilReleaseScope::GilReleaseScope()
+    : m_depth(std::exchange(Details::StaticGil::get_depth(), 0)) {}
+
+  inline GilReleaseScope::~GilReleaseScope() {
+    Details::StaticGil::get_depth() = m_depth;
+  }
+
   template<typename R>
   template<typename RF>
   GilAcquireReactor<R>::GilAcquireReactor(RF&& reactor)
@@ -45,14 +133,14 @@ namespace Aspen {
 
   template<typename R>
   State GilAcquireReactor<R>::commit(std::uint64_t sequence) noexcept {
-    auto lock = pybind11::gil_scoped_acquire();
+    auto lock = GilAcquireScope();
     return m_reactor->commit(sequence);
   }
 
   template<typename R>
   typename GilAcquireReactor<R>::Result GilAcquireReactor<R>::eval() const
       noexcept(is_noexcept_reactor_v<R>) {
-    auto lock = pybind11::gil_scoped_acquire();
+    auto lock = GilAcquireScope();
     return m_reactor->eval();
   }
 }
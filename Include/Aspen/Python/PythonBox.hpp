@@ -4,6 +4,7 @@
 #include <exception>
 #include <pybind11/pybind11.h>
 #include <utility>
+#include "Aspen/Maybe.hpp"
 #include "Aspen/Python/Exception.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/Traits.hpp"
@@ -11,7 +12,10 @@
 namespace Aspen {
 
   /**
-   * Wraps a Python object implementing a reactor into a box.
+   * Wraps a Python object implementing a reactor into a box. The object's
+   * commit and eval methods are looked up once on construction and invoked
+   * through the vectorcall protocol, and the converted evaluation is cached
+   * until the next commit.
    * @param <T> The type of value to evaluate to.
    */
   template<typename T>
@@ -27,21 +31,41 @@ namespace Aspen {
 
       State commit(std::uint64_t sequence) noexcept;
 
-      Type eval() const;
+      eval_result_t<Type> eval() const;
 
     private:
       pybind11::object m_reactor;
+      pybind11::object m_commit;
+      pybind11::object m_eval;
       std::exception_ptr m_exception;
+      mutable Maybe<Type> m_value;
+      mutable bool m_has_value;
   };
 
   template<typename T>
   PythonBox<T>::PythonBox(pybind11::object reactor)
-    : m_reactor(std::move(reactor)) {}
+    : m_reactor(std::move(reactor)),
+      m_commit(m_reactor.attr("commit")),
+      m_eval(m_reactor.attr("eval")),
+      m_has_value(false) {}
 
   template<typename T>
   State PythonBox<T>::commit(std::uint64_t sequence) noexcept {
+    m_has_value = false;
     try {
-      return m_reactor.attr("commit")(sequence).template cast<State>();
+      auto argument = pybind11::reinterpret_steal<pybind11::object>(
+        PyLong_FromUnsignedLongLong(sequence));
+      if(!argument) {
+        throw pybind11::error_already_set();
+      }
+      PyObject* arguments[] = { nullptr, argument.ptr() };
+      auto result = pybind11::reinterpret_steal<pybind11::object>(
+        PyObject_Vectorcall(m_commit.ptr(), arguments + 1,
+          1 | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr));
+      if(!result) {
+        throw pybind11::error_already_set();
+      }
+      return result.template cast<State>();
     } catch(const pybind11::error_already_set& error) {
       m_exception = std::make_exception_ptr(PythonException(error));
     } catch(...) {
@@ -51,15 +75,26 @@ namespace Aspen {
   }
 
   template<typename T>
-  typename PythonBox<T>::Type PythonBox<T>::eval() const {
+  eval_result_t<typename PythonBox<T>::Type> PythonBox<T>::eval() const {
     if(m_exception) {
       std::rethrow_exception(m_exception);
     }
-    try {
-      return m_reactor.attr("eval")().template cast<T>();
-    } catch(const pybind11::error_already_set& error) {
-      throw PythonException(error);
+    if(!m_has_value) {
+      m_value = try_call([&] {
+        try {
+          auto result = pybind11::reinterpret_steal<pybind11::object>(
+            PyObject_CallNoArgs(m_eval.ptr()));
+          if(!result) {
+            throw pybind11::error_already_set();
+          }
+          return result.template cast<Type>();
+        } catch(const pybind11::error_already_set& error) {
+          throw PythonException(error);
+        }
+      });
+      m_has_value = true;
     }
+    return m_value.get();
   }
 }
 
@@ -1,14 +1,23 @@
 #ifndef ASPEN_PYTHON_QUEUE_HPP
 #define ASPEN_PYTHON_QUEUE_HPP
+#include <cstddef>
+#include <ranges>
+#include <span>
 #include <string>
 #include <type_traits>
+#include <vector>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include "Aspen/Queue.hpp"
+#include "Aspen/Python/GilAcquireReactor.hpp"
 #include "Aspen/Python/Reactor.hpp"
 
 namespace Aspen {
 
-  /** Exports a Queue evaluating to a Python object. */
+  /**
+   * Exports the Queues evaluating to Python objects and to the native numeric
+   * types accepted by push_many.
+   */
   void export_queue(pybind11::module& module);
 
   /**
@@ -22,13 +31,34 @@ namespace Aspen {
     if(pybind11::hasattr(module, name.c_str())) {
       return;
     }
-    export_reactor<Queue<T>>(module, name)
+    auto queue = export_reactor<Queue<T>>(module, name)
       .def(pybind11::init<>())
       .def("push", &Queue<T>::push)
       .def("set_complete",
         static_cast<void (Queue<T>::*)()>(&Queue<T>::set_complete))
       .def("set_complete",
         static_cast<void (Queue<T>::*)(T)>(&Queue<T>::set_complete));
+    if constexpr(std::is_arithmetic_v<T>) {
+      queue.def("push_many",
+        [] (Queue<T>& self,
+            pybind11::array_t<T, pybind11::array::c_style> values) {
+          if(values.ndim() != 1) {
+            throw pybind11::value_error("Expected a one-dimensional array.");
+          }
+          auto release = GilReleaseScope();
+          self.push_many(std::span(values.data(),
+            static_cast<std::size_t>(values.size())));
+        });
+    } else {
+      queue.def("push_many",
+        [] (Queue<T>& self, const pybind11::iterable& values) {
+          auto entries = std::vector<T>();
+          for(auto value : values) {
+            entries.push_back(pybind11::cast<T>(value));
+          }
+          self.push_many(entries | std::views::as_rvalue);
+        });
+    }
     if constexpr(!std::is_same_v<T, pybind11::object>) {
       pybind11::implicitly_convertible<Queue<T>,
         Queue<pybind11::object>>();
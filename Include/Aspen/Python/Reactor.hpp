@@ -1,13 +1,20 @@
 #ifndef ASPEN_PYTHON_REACTOR_HPP
 #define ASPEN_PYTHON_REACTOR_HPP
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <pybind11/pybind11.h>
 #include "Aspen/Box.hpp"
+#include "Aspen/Constant.hpp"
 #include "Aspen/Conversions.hpp"
 #include "Aspen/Operators.hpp"
 #include "Aspen/Traits.hpp"
 #include "Aspen/Python/DllExports.hpp"
+#include "Aspen/Python/Exception.hpp"
+#include "Aspen/Python/GilAcquireReactor.hpp"
 #include "Aspen/Python/Object.hpp"
 #include "Aspen/Python/PythonBox.hpp"
 #include "Aspen/Python/ReactorPtr.hpp"
@@ -15,6 +22,211 @@
 
 namespace Aspen {
 
+namespace Details {
+  template<typename T>
+  constexpr auto is_python_integer_v = std::is_same_v<T, bool> ||
+    std::is_same_v<T, std::int64_t> || std::is_same_v<T, std::uint64_t>;
+
+  template<typename T>
+  constexpr auto is_python_float_v = std::is_same_v<T, double>;
+
+  constexpr auto MAX_EXACT_INTEGER = std::int64_t(1) << 53;
+
+  enum class NumericOperation {
+    ARITHMETIC,
+    DIVISION,
+    COMPARISON
+  };
+
+  [[noreturn]] inline void raise_overflow() {
+    throw std::overflow_error("Integer overflow.");
+  }
+
+  [[noreturn]] inline void raise_zero_division() {
+    auto lock = GilAcquireScope();
+    PyErr_SetString(PyExc_ZeroDivisionError, "float division by zero");
+    throw PythonException(pybind11::error_already_set());
+  }
+
+  inline std::int64_t to_int64(std::uint64_t value) {
+    if(value > static_cast<std::uint64_t>(
+        std::numeric_limits<std::int64_t>::max())) {
+      raise_overflow();
+    }
+    return static_cast<std::int64_t>(value);
+  }
+
+  struct NumericAdd {
+    double operator ()(double left, double right) const noexcept {
+      return left + right;
+    }
+
+    std::int64_t operator ()(std::int64_t left, std::int64_t right) const {
+      if(right > 0 ? left > std::numeric_limits<std::int64_t>::max() - right :
+          left < std::numeric_limits<std::int64_t>::min() - right) {
+        raise_overflow();
+      }
+      return left + right;
+    }
+  };
+
+  struct NumericSubtract {
+    double operator ()(double left, double right) const noexcept {
+      return left - right;
+    }
+
+    std::int64_t operator ()(std::int64_t left, std::int64_t right) const {
+      if(right < 0 ? left > std::numeric_limits<std::int64_t>::max() + right :
+          left < std::numeric_limits<std::int64_t>::min() + right) {
+        raise_overflow();
+      }
+      return left - right;
+    }
+  };
+
+  struct NumericMultiply {
+    double operator ()(double left, double right) const noexcept {
+      return left * right;
+    }
+
+    std::int64_t operator ()(std::int64_t left, std::int64_t right) const {
+      constexpr auto MAX = std::numeric_limits<std::int64_t>::max();
+      constexpr auto MIN = std::numeric_limits<std::int64_t>::min();
+      if(left > 0 ? (right > 0 ? left > MAX / right : right < MIN / left) :
+          (right > 0 ? left < MIN / right :
+            left != 0 && right < MAX / left)) {
+        raise_overflow();
+      }
+      return left * right;
+    }
+  };
+
+  struct NumericDivide {
+    double operator ()(double left, double right) const {
+      if(right == 0) {
+        raise_zero_division();
+      }
+      return left / right;
+    }
+  };
+
+  template<typename U, typename R>
+  SharedBox<U> to_numeric_box(const R& reactor) {
+    using Type = reactor_result_t<R>;
+    if constexpr(std::is_same_v<R, SharedBox<U>>) {
+      return reactor;
+    } else if constexpr(std::is_same_v<Type, U>) {
+      return shared_box(reactor);
+    } else if constexpr(std::is_same_v<Type, std::uint64_t> &&
+        std::is_same_v<U, std::int64_t>) {
+      return shared_box(lift([] (std::uint64_t value) {
+        return to_int64(value);
+      }, reactor));
+    } else {
+      return shared_box(lift([] (Type value) noexcept {
+        return static_cast<U>(value);
+      }, reactor));
+    }
+  }
+
+  template<typename T>
+  std::optional<SharedBox<T>> find_typed_reactor(
+      const pybind11::object& value) {
+    auto& boxers = find_boxers(value);
+    auto reactor = std::optional<SharedBox<T>>();
+    if(boxers.m_boxer != nullptr) {
+      boxers.m_boxer(value, &reactor, typeid(SharedBox<T>));
+    }
+    return reactor;
+  }
+
+  template<typename U>
+  std::optional<SharedBox<U>> find_integer_reactor(
+      const pybind11::object& value) {
+    if(auto reactor = find_typed_reactor<std::int64_t>(value)) {
+      return to_numeric_box<U>(*reactor);
+    } else if(auto reactor = find_typed_reactor<std::uint64_t>(value)) {
+      return to_numeric_box<U>(*reactor);
+    } else if(auto reactor = find_typed_reactor<bool>(value)) {
+      return to_numeric_box<U>(*reactor);
+    }
+    return std::nullopt;
+  }
+
+  inline std::optional<std::int64_t> to_integer(
+      const pybind11::object& value) {
+    if(!PyLong_CheckExact(value.ptr()) && !PyBool_Check(value.ptr())) {
+      return std::nullopt;
+    }
+    auto overflow = 0;
+    auto integer = PyLong_AsLongLongAndOverflow(value.ptr(), &overflow);
+    if(overflow != 0) {
+      return std::nullopt;
+    } else if(integer == -1 && PyErr_Occurred()) {
+      throw pybind11::error_already_set();
+    }
+    return static_cast<std::int64_t>(integer);
+  }
+
+  inline std::optional<SharedBox<std::int64_t>> to_integer_operand(
+      const pybind11::object& value) {
+    if(auto integer = to_integer(value)) {
+      return shared_box(constant(*integer));
+    }
+    return find_integer_reactor<std::int64_t>(value);
+  }
+
+  inline std::optional<SharedBox<double>> find_float_operand(
+      const pybind11::object& value) {
+    if(PyFloat_CheckExact(value.ptr())) {
+      return shared_box(constant(PyFloat_AS_DOUBLE(value.ptr())));
+    }
+    return find_typed_reactor<double>(value);
+  }
+
+  inline std::optional<SharedBox<double>> to_float_operand(
+      const pybind11::object& value, bool is_exact) {
+    if(auto integer = to_integer(value)) {
+      if(*integer > MAX_EXACT_INTEGER || *integer < -MAX_EXACT_INTEGER) {
+        return std::nullopt;
+      }
+      return shared_box(constant(static_cast<double>(*integer)));
+    } else if(auto reactor = find_float_operand(value)) {
+      return reactor;
+    } else if(is_exact) {
+      return std::nullopt;
+    }
+    return find_integer_reactor<double>(value);
+  }
+
+  template<NumericOperation O, typename R, typename F, typename G>
+  pybind11::object apply_numeric(const R& reactor,
+      const pybind11::object& other, F f, G fallback) {
+    using Type = reactor_result_t<R>;
+    if constexpr(is_python_integer_v<Type>) {
+      if constexpr(O != NumericOperation::DIVISION) {
+        if(auto right = to_integer_operand(other)) {
+          return pybind11::cast(shared_box(lift(f,
+            to_numeric_box<std::int64_t>(reactor), std::move(*right))));
+        }
+      }
+      if constexpr(O != NumericOperation::COMPARISON) {
+        if(auto right = find_float_operand(other)) {
+          return pybind11::cast(shared_box(lift(f,
+            to_numeric_box<double>(reactor), std::move(*right))));
+        }
+      }
+    } else if constexpr(is_python_float_v<Type>) {
+      if(auto right = to_float_operand(other,
+          O == NumericOperation::COMPARISON)) {
+        return pybind11::cast(shared_box(lift(f,
+          to_numeric_box<double>(reactor), std::move(*right))));
+      }
+    }
+    return pybind11::cast(fallback());
+  }
+}
+
   /** Casts a C++ reactor to an Python object. */
   template<typename R>
   decltype(auto) to_object(R&& reactor) {
@@ -105,19 +317,31 @@ namespace Aspen {
     register_reactor<T>(reactor);
     reactor.def("__add__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) + to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::ARITHMETIC>(
+          *self, object, Details::NumericAdd(), [&] {
+            return shared_box(to_object(*self) + to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__sub__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) - to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::ARITHMETIC>(
+          *self, object, Details::NumericSubtract(), [&] {
+            return shared_box(to_object(*self) - to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__mul__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) * to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::ARITHMETIC>(
+          *self, object, Details::NumericMultiply(), [&] {
+            return shared_box(to_object(*self) * to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__truediv__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) / to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::DIVISION>(
+          *self, object, Details::NumericDivide(), [&] {
+            return shared_box(to_object(*self) / to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__mod__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
@@ -149,19 +373,39 @@ namespace Aspen {
       }, pybind11::is_operator());
     reactor.def("__lt__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) < to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::COMPARISON>(
+          *self, object, [] (auto left, auto right) noexcept {
+            return left < right;
+          }, [&] {
+            return shared_box(to_object(*self) < to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__le__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) <= to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::COMPARISON>(
+          *self, object, [] (auto left, auto right) noexcept {
+            return left <= right;
+          }, [&] {
+            return shared_box(to_object(*self) <= to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__ge__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) >= to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::COMPARISON>(
+          *self, object, [] (auto left, auto right) noexcept {
+            return left >= right;
+          }, [&] {
+            return shared_box(to_object(*self) >= to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__gt__",
       [] (ReactorPtr<T>& self, const pybind11::object& object) {
-        return shared_box(to_object(*self) > to_python_reactor(object));
+        return Details::apply_numeric<Details::NumericOperation::COMPARISON>(
+          *self, object, [] (auto left, auto right) noexcept {
+            return left > right;
+          }, [&] {
+            return shared_box(to_object(*self) > to_python_reactor(object));
+          });
       }, pybind11::is_operator());
     reactor.def("__neg__",
       [] (ReactorPtr<T>& self) {
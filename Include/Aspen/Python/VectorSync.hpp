@@ -0,0 +1,14 @@
+#ifndef ASPEN_PYTHON_VECTOR_SYNC_HPP
+#define ASPEN_PYTHON_VECTOR_SYNC_HPP
+#include <pybind11/pybind11.h>
+
+namespace Aspen {
+
+  /**
+   * Exports a VectorSync over float reactors that evaluates to a read-only
+   * NumPy array viewing the synchronized values without copying them.
+   */
+  void export_vector_sync(pybind11::module& module);
+}
+
+#endif
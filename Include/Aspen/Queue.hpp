@@ -4,8 +4,10 @@
 #include <cstdint>
 #include <deque>
 #include <exception>
+#include <iterator>
 #include <mutex>
 #include <optional>
+#include <ranges>
 #include <stdexcept>
 #include <utility>
 #include "Aspen/CommitFlag.hpp"
@@ -36,6 +38,16 @@ namespace Aspen {
        */
       void push(Type value);
 
+      /**
+       * Pushes a range of values to the queue under a single lock, raising
+       * the CommitFlag at most once, ignored once complete or if the range is
+       * empty. If constructing any value throws, none of them are pushed.
+       * @param values The values to push.
+       */
+      template<std::ranges::input_range R> requires
+        std::constructible_from<T, std::ranges::range_reference_t<R>>
+      void push_many(R&& values);
+
       /** Brings this reactor to a completion state. */
       void set_complete();
 
@@ -97,6 +109,28 @@ namespace Aspen {
     });
   }
 
+  template<typename T>
+  template<std::ranges::input_range R> requires
+    std::constructible_from<T, std::ranges::range_reference_t<R>>
+  void Queue<T>::push_many(R&& values) {
+    auto entries = std::deque<Type>();
+    for(auto&& value : values) {
+      entries.emplace_back(std::forward<decltype(value)>(value));
+    }
+    if(entries.empty()) {
+      return;
+    }
+    update([&] {
+      if(m_entries.empty()) {
+        m_entries.swap(entries);
+      } else {
+        m_entries.insert(m_entries.end(),
+          std::make_move_iterator(entries.begin()),
+          std::make_move_iterator(entries.end()));
+      }
+    });
+  }
+
   template<typename T>
   void Queue<T>::set_complete() {
     update([&] {
@@ -1,6 +1,8 @@
 #ifndef ASPEN_SHARED_HPP
 #define ASPEN_SHARED_HPP
+#include <atomic>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -8,6 +10,7 @@
 #include <utility>
 #include "Aspen/Box.hpp"
 #include "Aspen/CommitFlag.hpp"
+#include "Aspen/GraphArena.hpp"
 #include "Aspen/Reactor.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/Traits.hpp"
@@ -38,8 +41,11 @@ namespace Details {
 
   template<typename R>
   struct SharedEvaluator {
-    std::shared_ptr<SharedState> m_state;
-    std::weak_ptr<R> m_reactor;
+    SharedState* m_state;
+    std::shared_ptr<SharedState> m_shared_state;
+    R* m_reactor;
+    std::atomic<std::size_t> m_references;
+    bool m_is_inline;
     Sequence m_sequence;
     Sequence m_evaluated;
     Sequence m_released_evaluation;
@@ -47,7 +53,34 @@ namespace Details {
       m_evaluation;
     bool m_is_committing;
 
-    explicit SharedEvaluator(std::shared_ptr<SharedState> state) noexcept;
+    SharedEvaluator(SharedState& state,
+      std::shared_ptr<SharedState> shared_state, R& reactor,
+      bool is_inline) noexcept;
+    R* acquire() noexcept;
+    void add_reference() noexcept;
+    void remove_reference() noexcept;
+  };
+
+  template<typename R>
+  struct SharedBlock {
+    SharedState m_state;
+    SharedEvaluator<R> m_evaluator;
+    union {
+      R m_reactor;
+    };
+
+    template<typename... A>
+    explicit SharedBlock(std::shared_ptr<SharedState> shared_state,
+      A&&... args);
+    ~SharedBlock();
+  };
+
+  template<typename R>
+  struct SharedHeapBlock {
+    SharedState m_state;
+    SharedEvaluator<R> m_evaluator;
+
+    explicit SharedHeapBlock(std::unique_ptr<R> reactor) noexcept;
   };
 
   inline Sequence::Sequence() noexcept
@@ -71,10 +104,66 @@ namespace Details {
     : m_state(State::NONE) {}
 
   template<typename R>
-  SharedEvaluator<R>::SharedEvaluator(
-    std::shared_ptr<SharedState> state) noexcept
-    : m_state(std::move(state)),
+  SharedEvaluator<R>::SharedEvaluator(SharedState& state,
+    std::shared_ptr<SharedState> shared_state, R& reactor,
+    bool is_inline) noexcept
+    : m_state(shared_state ? shared_state.get() : &state),
+      m_shared_state(std::move(shared_state)),
+      m_reactor(&reactor),
+      m_references(1),
+      m_is_inline(is_inline),
       m_is_committing(false) {}
+
+  template<typename R>
+  R* SharedEvaluator<R>::acquire() noexcept {
+    auto references = m_references.load(std::memory_order_relaxed);
+    while(references != 0) {
+      if(m_references.compare_exchange_weak(references, references + 1,
+          std::memory_order_acquire, std::memory_order_relaxed)) {
+        return m_reactor;
+      }
+    }
+    return nullptr;
+  }
+
+  template<typename R>
+  void SharedEvaluator<R>::add_reference() noexcept {
+    m_references.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template<typename R>
+  void SharedEvaluator<R>::remove_reference() noexcept {
+    if(m_references.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    if(m_is_inline) {
+      std::destroy_at(m_reactor);
+    } else {
+      delete m_reactor;
+    }
+  }
+
+  template<typename R>
+  template<typename... A>
+  SharedBlock<R>::SharedBlock(
+      std::shared_ptr<SharedState> shared_state, A&&... args)
+      : m_evaluator(m_state, std::move(shared_state), m_reactor, true) {
+    std::construct_at(&m_reactor, std::forward<A>(args)...);
+  }
+
+  template<typename R>
+  SharedBlock<R>::~SharedBlock() {}
+
+  template<typename R>
+  SharedHeapBlock<R>::SharedHeapBlock(std::unique_ptr<R> reactor) noexcept
+    : m_evaluator(m_state, nullptr, *reactor.release(), false) {}
+
+  template<typename B>
+  auto make_shared_evaluator(std::shared_ptr<B> block) noexcept {
+    auto evaluator = &block->m_evaluator;
+    return std::shared_ptr<decltype(block->m_evaluator)>(
+      std::move(block), evaluator);
+  }
 }
 
   /**
@@ -138,7 +227,7 @@ namespace Details {
       template<IsReactor> friend class Shared;
       template<IsReactor> friend class Weak;
       std::shared_ptr<Details::SharedEvaluator<Reactor>> m_evaluator;
-      std::shared_ptr<Reactor> m_reactor;
+      Reactor* m_reactor;
       Details::Sequence m_last_evaluation;
       CommitFlag* m_parent;
 
@@ -146,8 +235,8 @@ namespace Details {
         Details::SharedEvaluator<Reactor>& evaluator,
         Details::Sequence& last_evaluation, CommitFlag* current);
 
-      Shared(std::shared_ptr<Details::SharedEvaluator<Reactor>> evaluator,
-        std::shared_ptr<Reactor> reactor) noexcept;
+      explicit Shared(
+        std::shared_ptr<Details::SharedEvaluator<Reactor>> evaluator) noexcept;
       void release() noexcept;
       void set_parent(CommitFlag* parent) noexcept;
   };
@@ -190,48 +279,44 @@ namespace Details {
 
   template<IsReactor R>
   Shared<R>::Shared()
-    : Shared(std::make_shared<Details::SharedEvaluator<Reactor>>(
-        std::make_shared<Details::SharedState>()),
-        std::make_shared<Reactor>()) {
-    m_evaluator->m_reactor = m_reactor;
-  }
+    : Shared(Details::make_shared_evaluator(
+        Details::make_arena_shared<Details::SharedBlock<Reactor>>(nullptr))) {}
 
   template<IsReactor R>
   template<typename A, typename... B> requires(
     !std::derived_from<std::remove_cvref_t<A>, Shared<R>>)
   Shared<R>::Shared(A&& a, B&&... args)
-    : Shared(std::make_shared<Details::SharedEvaluator<Reactor>>(
-        std::make_shared<Details::SharedState>()),
-        std::make_shared<Reactor>(std::forward<A>(a),
-        std::forward<B>(args)...)) {
-    m_evaluator->m_reactor = m_reactor;
-  }
+    : Shared(Details::make_shared_evaluator(
+        Details::make_arena_shared<Details::SharedBlock<Reactor>>(nullptr,
+          std::forward<A>(a), std::forward<B>(args)...))) {}
 
   template<IsReactor R>
   Shared<R>::Shared(Unique<Reactor> reactor)
-    : Shared(std::make_shared<Details::SharedEvaluator<Reactor>>(
-        std::make_shared<Details::SharedState>()),
-        std::shared_ptr<Reactor>(std::move(reactor.m_reactor))) {
-    m_evaluator->m_reactor = m_reactor;
-  }
+    : Shared(Details::make_shared_evaluator(
+        Details::make_arena_shared<Details::SharedHeapBlock<Reactor>>(
+          std::move(reactor.m_reactor)))) {}
 
   template<IsReactor R>
   template<typename U> requires IsBox<R>
   Shared<R>::Shared(Shared<U> reactor)
-      : Shared(std::make_shared<Details::SharedEvaluator<Reactor>>(
-          reactor.m_evaluator->m_state), std::shared_ptr<Reactor>()) {
-    m_reactor = std::make_shared<Reactor>(std::move(reactor));
-    m_evaluator->m_reactor = m_reactor;
-  }
+    : Shared(Details::make_shared_evaluator(
+        Details::make_arena_shared<Details::SharedBlock<Reactor>>(
+          std::shared_ptr<Details::SharedState>(
+            reactor.m_evaluator, reactor.m_evaluator->m_state),
+          std::move(reactor)))) {}
 
   template<IsReactor R>
   Shared<R>::Shared(const Shared& shared) noexcept
-    : Shared(shared.m_evaluator, shared.m_reactor) {}
+      : m_evaluator(shared.m_evaluator),
+        m_reactor(shared.m_reactor),
+        m_parent(nullptr) {
+    m_evaluator->add_reference();
+  }
 
   template<IsReactor R>
   Shared<R>::Shared(Shared&& shared) noexcept
       : m_evaluator(std::move(shared.m_evaluator)),
-        m_reactor(std::move(shared.m_reactor)),
+        m_reactor(shared.m_reactor),
         m_last_evaluation(shared.m_last_evaluation),
         m_parent(nullptr) {
     if(shared.m_parent) {
@@ -254,7 +339,7 @@ namespace Details {
 
   template<IsReactor R>
   const typename Shared<R>::Reactor* Shared<R>::operator ->() const noexcept {
-    return m_reactor.get();
+    return m_reactor;
   }
 
   template<IsReactor R>
@@ -264,7 +349,7 @@ namespace Details {
 
   template<IsReactor R>
   typename Shared<R>::Reactor* Shared<R>::operator ->() noexcept {
-    return m_reactor.get();
+    return m_reactor;
   }
 
   template<IsReactor R>
@@ -293,6 +378,7 @@ namespace Details {
     }
     m_evaluator = shared.m_evaluator;
     m_reactor = shared.m_reactor;
+    m_evaluator->add_reference();
     m_last_evaluation = Details::Sequence();
     return *this;
   }
@@ -306,7 +392,7 @@ namespace Details {
       release();
     }
     m_evaluator = std::move(shared.m_evaluator);
-    m_reactor = std::move(shared.m_reactor);
+    m_reactor = shared.m_reactor;
     m_last_evaluation = shared.m_last_evaluation;
     m_parent = nullptr;
     if(shared.m_parent) {
@@ -390,21 +476,22 @@ namespace Details {
 
   template<IsReactor R>
   Shared<R>::Shared(
-    std::shared_ptr<Details::SharedEvaluator<Reactor>> evaluator,
-    std::shared_ptr<Reactor> reactor) noexcept
+    std::shared_ptr<Details::SharedEvaluator<Reactor>> evaluator) noexcept
     : m_evaluator(std::move(evaluator)),
-      m_reactor(std::move(reactor)),
+      m_reactor(m_evaluator->m_reactor),
       m_parent(nullptr) {}
 
   template<IsReactor R>
   void Shared<R>::release() noexcept {
     set_parent(nullptr);
-    if(m_evaluator.use_count() > 1 && m_reactor.use_count() == 1 &&
+    if(m_evaluator.use_count() > 1 &&
+        m_evaluator->m_references.load(std::memory_order_acquire) == 1 &&
         m_evaluator->m_evaluated.m_is_set) {
       try_assign(m_evaluator->m_evaluation, *m_reactor);
       m_evaluator->m_released_evaluation =
         m_evaluator->m_state->m_last_evaluation;
     }
+    m_evaluator->remove_reference();
   }
 
   template<IsReactor R>
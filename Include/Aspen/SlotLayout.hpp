@@ -0,0 +1,53 @@
+#ifndef ASPEN_SLOT_LAYOUT_HPP
+#define ASPEN_SLOT_LAYOUT_HPP
+#include <atomic>
+#include <cstddef>
+
+namespace Aspen {
+
+  /** The size of a cache line assumed when padding words of raised slots. */
+  inline constexpr auto CACHE_LINE_SIZE = std::size_t(64);
+
+  /**
+   * Lays out the bits raised by a reactor's children by packing 64
+   * consecutive children into each word, contiguously in memory. Uses the
+   * least memory and scans the fewest words, but children raised from
+   * different threads contend for the same cache lines.
+   */
+  struct PackedSlotLayout {
+
+    /** The number of children whose bits share a word. */
+    static constexpr auto SLOTS_PER_WORD = std::size_t(64);
+
+    /** Stores the raised bits of SLOTS_PER_WORD children. */
+    struct Word {
+
+      /** The raised bits. */
+      std::atomic_uint64_t m_bits;
+    };
+  };
+
+  /**
+   * Lays out the bits raised by a reactor's children by placing each word on
+   * its own cache line, so that children raised from different threads do not
+   * contend for the same cache line unless they share a word.
+   * @param <N> The number of consecutive children whose bits share a word.
+   */
+  template<std::size_t N = 1>
+  struct PaddedSlotLayout {
+    static_assert(N != 0 && N <= 64,
+      "A word holds between 1 and 64 children.");
+
+    /** The number of children whose bits share a word. */
+    static constexpr auto SLOTS_PER_WORD = N;
+
+    /** Stores the raised bits of SLOTS_PER_WORD children. */
+    struct alignas(CACHE_LINE_SIZE) Word {
+
+      /** The raised bits. */
+      std::atomic_uint64_t m_bits;
+    };
+  };
+}
+
+#endif
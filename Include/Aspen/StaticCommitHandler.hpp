@@ -8,6 +8,7 @@
 #include <type_traits>
 #include <utility>
 #include "Aspen/CommitFlag.hpp"
+#include "Aspen/Profiler.hpp"
 #include "Aspen/Reactor.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/Traits.hpp"
@@ -224,10 +225,10 @@ namespace Details {
           }
         } else {
           child.m_flag.clear();
-          {
+          child.m_state = profile_commit(child.m_flag, child.m_reactor, [&] {
             auto scope = CommitFlagScope(child.m_flag);
-            child.m_state = child.m_reactor.commit(sequence);
-          }
+            return child.m_reactor.commit(sequence);
+          });
           if(is_initializing) {
             child.m_has_evaluation |= has_evaluation(child.m_state);
             if(child.m_has_evaluation) {
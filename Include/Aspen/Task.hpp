@@ -0,0 +1,205 @@
+#ifndef ASPEN_TASK_HPP
+#define ASPEN_TASK_HPP
+#include <concepts>
+#include <coroutine>
+#include <cstdint>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include "Aspen/Maybe.hpp"
+#include "Aspen/Reactor.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Traits.hpp"
+
+namespace Aspen {
+namespace Details {
+  struct TaskAwaiter {
+    virtual ~TaskAwaiter() = default;
+
+    virtual State commit(std::uint64_t sequence) noexcept = 0;
+  };
+
+  template<typename R>
+  struct TaskReactorAwaiter final : TaskAwaiter {
+    using Reactor = std::remove_cvref_t<R>;
+    R m_reactor;
+
+    template<typename Q>
+    explicit TaskReactorAwaiter(Q&& reactor)
+      : m_reactor(std::forward<Q>(reactor)) {}
+
+    bool await_ready() const noexcept {
+      return false;
+    }
+
+    template<typename P>
+    void await_suspend(std::coroutine_handle<P> handle) noexcept {
+      handle.promise().m_awaiter = this;
+      handle.promise().m_state = State::CONTINUE;
+    }
+
+    typename Reactor::Type await_resume() {
+      if constexpr(std::is_void_v<typename Reactor::Type>) {
+        std::as_const(m_reactor).eval();
+      } else {
+        return std::as_const(m_reactor).eval();
+      }
+    }
+
+    State commit(std::uint64_t sequence) noexcept override {
+      return m_reactor.commit(sequence);
+    }
+  };
+
+  template<typename T>
+  struct TaskPromiseBase {
+    Maybe<T> m_value;
+    State m_state;
+    TaskAwaiter* m_awaiter;
+
+    TaskPromiseBase() noexcept
+      : m_state(State::NONE),
+        m_awaiter(nullptr) {}
+
+    std::suspend_always initial_suspend() const noexcept {
+      return {};
+    }
+
+    std::suspend_always final_suspend() const noexcept {
+      return {};
+    }
+
+    void unhandled_exception() noexcept {
+      m_value = Maybe<T>(std::current_exception());
+      m_state = State::COMPLETE_EVALUATED;
+    }
+
+    template<typename R> requires IsReactor<std::remove_cvref_t<R>>
+    auto await_transform(R&& reactor) {
+      return TaskReactorAwaiter<R>(std::forward<R>(reactor));
+    }
+  };
+
+  template<typename T>
+  struct TaskPromise : TaskPromiseBase<T> {
+    template<typename U> requires std::constructible_from<T, U&&>
+    std::suspend_always yield_value(U&& value) {
+      this->m_value = T(std::forward<U>(value));
+      this->m_state = State::CONTINUE_EVALUATED;
+      return {};
+    }
+
+    template<typename U> requires std::constructible_from<T, U&&>
+    void return_value(U&& value) {
+      this->m_value = T(std::forward<U>(value));
+      this->m_state = State::COMPLETE_EVALUATED;
+    }
+  };
+
+  template<>
+  struct TaskPromise<void> : TaskPromiseBase<void> {
+    void return_void() noexcept {
+      m_state = State::COMPLETE;
+    }
+  };
+}
+
+  /**
+   * A reactor implemented by a coroutine that runs on the committing thread.
+   * Each commit resumes the coroutine until its next suspension point:
+   * <code>co_yield</code> evaluates to a value and continues on the next
+   * commit, <code>co_await</code> on a reactor suspends until that reactor
+   * evaluates and returns its evaluation, and <code>co_return</code> completes.
+   * Reactors are awaited by reference when passed as an lvalue and by value
+   * otherwise, and are committed within this reactor's CommitFlag so that any
+   * update resumes the coroutine.
+   * @param <T> The type to evaluate to.
+   */
+  template<typename T>
+  class Task {
+    public:
+
+      /** The type to evaluate to. */
+      using Type = T;
+
+      /** The coroutine's promise type. */
+      struct promise_type : Details::TaskPromise<Type> {
+        Task get_return_object() noexcept;
+      };
+
+      Task(Task&& task) noexcept;
+
+      ~Task();
+
+      State commit(std::uint64_t sequence) noexcept;
+      eval_result_t<Type> eval() const;
+      Task& operator =(Task&& task) noexcept;
+
+    private:
+      std::coroutine_handle<promise_type> m_handle;
+
+      explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+      Task(const Task&) = delete;
+      Task& operator =(const Task&) = delete;
+  };
+
+  template<typename T>
+  Task<T> Task<T>::promise_type::get_return_object() noexcept {
+    return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+  }
+
+  template<typename T>
+  Task<T>::Task(std::coroutine_handle<promise_type> handle) noexcept
+    : m_handle(handle) {}
+
+  template<typename T>
+  Task<T>::Task(Task&& task) noexcept
+    : m_handle(std::exchange(task.m_handle, nullptr)) {}
+
+  template<typename T>
+  Task<T>::~Task() {
+    if(m_handle) {
+      m_handle.destroy();
+    }
+  }
+
+  template<typename T>
+  State Task<T>::commit(std::uint64_t sequence) noexcept {
+    if(!m_handle || m_handle.done()) {
+      return State::COMPLETE;
+    }
+    auto& promise = m_handle.promise();
+    if(promise.m_awaiter) {
+      auto state = promise.m_awaiter->commit(sequence);
+      if(!has_evaluation(state) && !is_complete(state)) {
+        if(has_continuation(state)) {
+          return State::CONTINUE;
+        }
+        return State::NONE;
+      }
+      promise.m_awaiter = nullptr;
+    }
+    promise.m_state = State::NONE;
+    m_handle.resume();
+    return promise.m_state;
+  }
+
+  template<typename T>
+  eval_result_t<typename Task<T>::Type> Task<T>::eval() const {
+    return std::as_const(m_handle.promise().m_value).get();
+  }
+
+  template<typename T>
+  Task<T>& Task<T>::operator =(Task&& task) noexcept {
+    if(this == &task) {
+      return *this;
+    }
+    if(m_handle) {
+      m_handle.destroy();
+    }
+    m_handle = std::exchange(task.m_handle, nullptr);
+    return *this;
+  }
+}
+
+#endif
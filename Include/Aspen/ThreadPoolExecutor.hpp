@@ -0,0 +1,314 @@
+#ifndef ASPEN_THREAD_POOL_EXECUTOR_HPP
+#define ASPEN_THREAD_POOL_EXECUTOR_HPP
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Aspen/Box.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Profiler.hpp"
+#include "Aspen/Reactor.hpp"
+#include "Aspen/State.hpp"
+#include "Aspen/Transaction.hpp"
+#include "Aspen/Trigger.hpp"
+
+namespace Aspen {
+
+  /**
+   * Runs many independent reactors on a fixed pool of worker threads. A reactor
+   * is only scheduled once its root CommitFlag signals that an update is
+   * available, each worker commits the reactors in its own queue and steals
+   * from the queues of other workers once its own is empty.
+   */
+  class ThreadPoolExecutor {
+    public:
+
+      /** Constructs a ThreadPoolExecutor with one worker per core. */
+      ThreadPoolExecutor();
+
+      /**
+       * Constructs a ThreadPoolExecutor.
+       * @param thread_count The number of worker threads to run.
+       */
+      explicit ThreadPoolExecutor(std::size_t thread_count);
+
+      /** Aborts this executor and joins its worker threads. */
+      ~ThreadPoolExecutor();
+
+      /** Returns the number of worker threads. */
+      std::size_t get_thread_count() const noexcept;
+
+      /**
+       * Adds a reactor to execute until it completes, callable from any thread.
+       * @param reactor The reactor to execute.
+       */
+      template<typename R> requires IsReactor<std::remove_cvref_t<R>>
+      void add(R&& reactor);
+
+      /**
+       * Blocks until every reactor added has completed or this executor is
+       * aborted.
+       */
+      void wait();
+
+      /**
+       * Permanently stops this executor, callable from any thread.
+       * Commits in progress finish and no further commit executes.
+       */
+      void abort();
+
+    private:
+      enum class Status : std::uint8_t {
+        IDLE,
+        QUEUED,
+        RUNNING,
+        PENDING
+      };
+      struct Graph {
+        ThreadPoolExecutor* m_executor;
+        Trigger m_trigger;
+        CommitFlag m_flag;
+        Box<void> m_reactor;
+        std::uint64_t m_sequence;
+        std::size_t m_index;
+        std::atomic<Status> m_status;
+
+        template<typename R>
+        Graph(ThreadPoolExecutor& executor, R&& reactor);
+      };
+      struct Worker {
+        std::mutex m_mutex;
+        std::deque<Graph*> m_queue;
+      };
+      static inline thread_local auto m_current_executor =
+        static_cast<ThreadPoolExecutor*>(nullptr);
+      static inline thread_local auto m_current_worker = std::size_t(0);
+      std::mutex m_mutex;
+      std::condition_variable m_work_condition;
+      std::condition_variable m_completion_condition;
+      std::vector<std::unique_ptr<Graph>> m_graphs;
+      std::vector<std::unique_ptr<Worker>> m_workers;
+      std::atomic_size_t m_queued;
+      std::atomic_size_t m_sleepers;
+      std::atomic_size_t m_next_worker;
+      std::atomic_bool m_is_aborted;
+      std::vector<std::thread> m_threads;
+
+      void schedule(Graph& graph) noexcept;
+      void push(Graph& graph);
+      Graph* pop(std::size_t index) noexcept;
+      void run(Graph& graph);
+      void remove(Graph& graph);
+      void work(std::size_t index);
+      ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+      ThreadPoolExecutor& operator =(const ThreadPoolExecutor&) = delete;
+  };
+
+  inline ThreadPoolExecutor::ThreadPoolExecutor()
+    : ThreadPoolExecutor(std::thread::hardware_concurrency()) {}
+
+  inline ThreadPoolExecutor::ThreadPoolExecutor(std::size_t thread_count)
+      : m_queued(0),
+        m_sleepers(0),
+        m_next_worker(0),
+        m_is_aborted(false) {
+    thread_count = std::max(thread_count, std::size_t(1));
+    m_workers.reserve(thread_count);
+    for(auto i = std::size_t(0); i != thread_count; ++i) {
+      m_workers.push_back(std::make_unique<Worker>());
+    }
+    m_threads.reserve(thread_count);
+    for(auto i = std::size_t(0); i != thread_count; ++i) {
+      m_threads.emplace_back([this, i] {
+        work(i);
+      });
+    }
+  }
+
+  inline ThreadPoolExecutor::~ThreadPoolExecutor() {
+    abort();
+    for(auto& thread : m_threads) {
+      thread.join();
+    }
+  }
+
+  inline std::size_t ThreadPoolExecutor::get_thread_count() const noexcept {
+    return m_threads.size();
+  }
+
+  template<typename R> requires IsReactor<std::remove_cvref_t<R>>
+  void ThreadPoolExecutor::add(R&& reactor) {
+    auto graph = std::make_unique<Graph>(*this, std::forward<R>(reactor));
+    auto& added = *graph;
+    {
+      auto lock = std::lock_guard(m_mutex);
+      added.m_index = m_graphs.size();
+      m_graphs.push_back(std::move(graph));
+    }
+    push(added);
+  }
+
+  inline void ThreadPoolExecutor::wait() {
+    auto lock = std::unique_lock(m_mutex);
+    m_completion_condition.wait(lock, [&] {
+      return m_graphs.empty() || m_is_aborted.load();
+    });
+  }
+
+  inline void ThreadPoolExecutor::abort() {
+    {
+      auto lock = std::lock_guard(m_mutex);
+      m_is_aborted.store(true);
+    }
+    m_work_condition.notify_all();
+    m_completion_condition.notify_all();
+  }
+
+  template<typename R>
+  ThreadPoolExecutor::Graph::Graph(ThreadPoolExecutor& executor, R&& reactor)
+      : m_executor(&executor),
+        m_trigger([this] {
+          m_executor->schedule(*this);
+        }),
+        m_reactor(std::forward<R>(reactor)),
+        m_sequence(0),
+        m_index(0),
+        m_status(Status::QUEUED) {
+    m_flag.set_trigger(&m_trigger);
+  }
+
+  inline void ThreadPoolExecutor::schedule(Graph& graph) noexcept {
+    auto status = graph.m_status.load();
+    while(true) {
+      if(status == Status::IDLE) {
+        if(graph.m_status.compare_exchange_weak(status, Status::QUEUED)) {
+          try {
+            push(graph);
+          } catch(...) {
+            graph.m_status.store(Status::IDLE);
+          }
+          return;
+        }
+      } else if(status == Status::RUNNING) {
+        if(graph.m_status.compare_exchange_weak(status, Status::PENDING)) {
+          return;
+        }
+      } else {
+        return;
+      }
+    }
+  }
+
+  inline void ThreadPoolExecutor::push(Graph& graph) {
+    auto index = [&] {
+      if(m_current_executor == this) {
+        return m_current_worker;
+      }
+      return m_next_worker.fetch_add(1, std::memory_order_relaxed) %
+        m_workers.size();
+    }();
+    auto& worker = *m_workers[index];
+    {
+      auto lock = std::lock_guard(worker.m_mutex);
+      worker.m_queue.push_back(&graph);
+    }
+    m_queued.fetch_add(1);
+    if(m_sleepers.load() != 0) {
+      auto lock = std::lock_guard(m_mutex);
+      m_work_condition.notify_one();
+    }
+  }
+
+  inline ThreadPoolExecutor::Graph* ThreadPoolExecutor::pop(
+      std::size_t index) noexcept {
+    for(auto i = std::size_t(0); i != m_workers.size(); ++i) {
+      auto& worker = *m_workers[(index + i) % m_workers.size()];
+      auto lock = std::lock_guard(worker.m_mutex);
+      if(worker.m_queue.empty()) {
+        continue;
+      }
+      auto graph = static_cast<Graph*>(nullptr);
+      if(i == 0) {
+        graph = worker.m_queue.front();
+        worker.m_queue.pop_front();
+      } else {
+        graph = worker.m_queue.back();
+        worker.m_queue.pop_back();
+      }
+      m_queued.fetch_sub(1);
+      return graph;
+    }
+    return nullptr;
+  }
+
+  inline void ThreadPoolExecutor::run(Graph& graph) {
+    graph.m_status.store(Status::RUNNING);
+    auto previous = Trigger::get_trigger();
+    Trigger::set_trigger(graph.m_trigger);
+    graph.m_flag.clear();
+    auto state = profile_commit(graph.m_flag, graph.m_reactor, [&] {
+      auto scope = CommitFlagScope(graph.m_flag);
+      auto snapshot = TransactionSnapshot();
+      return graph.m_reactor.commit(graph.m_sequence);
+    });
+    ++graph.m_sequence;
+    Trigger::set_trigger(previous);
+    if(is_complete(state)) {
+      remove(graph);
+      return;
+    }
+    if(!has_continuation(state)) {
+      auto status = Status::RUNNING;
+      if(graph.m_status.compare_exchange_strong(status, Status::IDLE)) {
+        return;
+      }
+    }
+    graph.m_status.store(Status::QUEUED);
+    push(graph);
+  }
+
+  inline void ThreadPoolExecutor::remove(Graph& graph) {
+    auto removed = [&] {
+      auto lock = std::lock_guard(m_mutex);
+      auto index = graph.m_index;
+      auto removed = std::move(m_graphs[index]);
+      if(index != m_graphs.size() - 1) {
+        m_graphs[index] = std::move(m_graphs.back());
+        m_graphs[index]->m_index = index;
+      }
+      m_graphs.pop_back();
+      if(m_graphs.empty()) {
+        m_completion_condition.notify_all();
+      }
+      return removed;
+    }();
+  }
+
+  inline void ThreadPoolExecutor::work(std::size_t index) {
+    m_current_executor = this;
+    m_current_worker = index;
+    while(!m_is_aborted.load()) {
+      if(auto graph = pop(index)) {
+        run(*graph);
+        continue;
+      }
+      auto lock = std::unique_lock(m_mutex);
+      m_sleepers.fetch_add(1);
+      m_work_condition.wait(lock, [&] {
+        return m_queued.load() != 0 || m_is_aborted.load();
+      });
+      m_sleepers.fetch_sub(1);
+    }
+    m_current_executor = nullptr;
+  }
+}
+
+#endif
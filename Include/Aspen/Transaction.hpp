@@ -0,0 +1,221 @@
+#ifndef ASPEN_TRANSACTION_HPP
+#define ASPEN_TRANSACTION_HPP
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Python/DllExports.hpp"
+
+namespace Aspen {
+  class Transaction;
+
+namespace Details {
+  struct ASPEN_EXPORT_DLL StaticTransaction {
+    static Transaction*& get_current() noexcept;
+    static std::uint64_t& get_snapshot() noexcept;
+    static std::atomic_uint64_t& get_version() noexcept;
+    static std::mutex& get_mutex() noexcept;
+  };
+
+#ifndef ASPEN_USE_DLL
+  ASPEN_EMIT_DLL inline Transaction*&
+      StaticTransaction::get_current() noexcept {
+    static thread_local auto current_transaction =
+      static_cast<Transaction*>(nullptr);
+    return current_transaction;
+  }
+
+  ASPEN_EMIT_DLL inline std::uint64_t&
+      StaticTransaction::get_snapshot() noexcept {
+    static thread_local auto snapshot =
+      std::numeric_limits<std::uint64_t>::max();
+    return snapshot;
+  }
+
+  ASPEN_EMIT_DLL inline std::atomic_uint64_t&
+      StaticTransaction::get_version() noexcept {
+    static auto version = std::atomic_uint64_t(0);
+    return version;
+  }
+
+  ASPEN_EMIT_DLL inline std::mutex& StaticTransaction::get_mutex() noexcept {
+    static auto mutex = std::mutex();
+    return mutex;
+  }
+#endif
+
+  struct StagedUpdate {
+    virtual ~StagedUpdate() = default;
+    virtual CommitFlag* apply(std::uint64_t version) = 0;
+  };
+
+  template<typename F>
+  struct StagedFunction final : StagedUpdate {
+    F m_function;
+
+    template<typename FF>
+    explicit StagedFunction(FF&& function)
+      : m_function(std::forward<FF>(function)) {}
+
+    CommitFlag* apply(std::uint64_t version) override {
+      return m_function(version);
+    }
+  };
+}
+
+  /**
+   * Stages updates made on the current thread so that they are published
+   * together. While a Transaction is active, setting a Cell stages the new
+   * value instead of publishing it. Committing the transaction publishes every
+   * staged value under a single version and raises each affected CommitFlag
+   * once, so a commit taken under a TransactionSnapshot observes either all of
+   * the transaction's updates or none of them. Every Cell updated within a
+   * Transaction must outlive it.
+   */
+  class Transaction {
+    public:
+
+      /** Returns the Transaction active on the current thread, if any. */
+      static Transaction* get_current() noexcept;
+
+      /**
+       * Returns the most recent version visible to commits on the current
+       * thread.
+       */
+      static std::uint64_t get_visible_version() noexcept;
+
+      /** Begins a Transaction, making it active on the current thread. */
+      Transaction() noexcept;
+
+      /**
+       * Discards any update that was not committed and restores the
+       * previously active Transaction.
+       */
+      ~Transaction();
+
+      /**
+       * Stages an update to apply when this transaction is committed.
+       * @param update The update to stage, called with the version being
+       *        published and returning the CommitFlag to raise, if any.
+       */
+      template<typename F> requires
+        std::is_invocable_r_v<CommitFlag*, std::decay_t<F>&, std::uint64_t>
+      void stage(F&& update);
+
+      /**
+       * Publishes all staged updates and raises their flags. Updates made
+       * afterwards are staged for a subsequent commit.
+       */
+      void commit();
+
+    private:
+      Transaction* m_previous;
+      std::vector<std::unique_ptr<Details::StagedUpdate>> m_updates;
+
+      Transaction(const Transaction&) = delete;
+      Transaction& operator =(const Transaction&) = delete;
+  };
+
+  /**
+   * Fixes the version visible to commits made on the current thread for the
+   * duration of its scope, so that a transaction published part way through a
+   * commit is deferred to the next commit in its entirety.
+   */
+  class TransactionSnapshot {
+    public:
+
+      /** Takes a snapshot of the most recently published version. */
+      TransactionSnapshot() noexcept;
+
+      /**
+       * Takes a snapshot of a specific version, used to share a snapshot
+       * taken on one thread with commits made on another.
+       * @param version The version to make visible.
+       */
+      explicit TransactionSnapshot(std::uint64_t version) noexcept;
+
+      ~TransactionSnapshot();
+
+    private:
+      std::uint64_t m_previous;
+
+      TransactionSnapshot(const TransactionSnapshot&) = delete;
+      TransactionSnapshot& operator =(const TransactionSnapshot&) = delete;
+  };
+
+  inline Transaction* Transaction::get_current() noexcept {
+    return Details::StaticTransaction::get_current();
+  }
+
+  inline std::uint64_t Transaction::get_visible_version() noexcept {
+    auto snapshot = Details::StaticTransaction::get_snapshot();
+    if(snapshot != std::numeric_limits<std::uint64_t>::max()) {
+      return snapshot;
+    }
+    return Details::StaticTransaction::get_version().load(
+      std::memory_order_acquire);
+  }
+
+  inline Transaction::Transaction() noexcept
+      : m_previous(Details::StaticTransaction::get_current()) {
+    Details::StaticTransaction::get_current() = this;
+  }
+
+  inline Transaction::~Transaction() {
+    Details::StaticTransaction::get_current() = m_previous;
+  }
+
+  template<typename F> requires
+    std::is_invocable_r_v<CommitFlag*, std::decay_t<F>&, std::uint64_t>
+  void Transaction::stage(F&& update) {
+    m_updates.push_back(std::make_unique<
+      Details::StagedFunction<std::decay_t<F>>>(std::forward<F>(update)));
+  }
+
+  inline void Transaction::commit() {
+    auto updates = std::exchange(m_updates, {});
+    if(updates.empty()) {
+      return;
+    }
+    auto flags = std::vector<CommitFlag*>();
+    auto lock = std::lock_guard(Details::StaticTransaction::get_mutex());
+    auto& version = Details::StaticTransaction::get_version();
+    auto next = version.load(std::memory_order_relaxed) + 1;
+    for(auto& update : updates) {
+      if(auto flag = update->apply(next)) {
+        flags.push_back(flag);
+      }
+    }
+    std::sort(flags.begin(), flags.end());
+    flags.erase(std::unique(flags.begin(), flags.end()), flags.end());
+    for(auto flag : flags) {
+      flag->raise();
+    }
+    version.store(next, std::memory_order_release);
+  }
+
+  inline TransactionSnapshot::TransactionSnapshot() noexcept
+      : m_previous(Details::StaticTransaction::get_snapshot()) {
+    Details::StaticTransaction::get_snapshot() =
+      Details::StaticTransaction::get_version().load(std::memory_order_acquire);
+  }
+
+  inline TransactionSnapshot::TransactionSnapshot(
+      std::uint64_t version) noexcept
+      : m_previous(Details::StaticTransaction::get_snapshot()) {
+    Details::StaticTransaction::get_snapshot() = version;
+  }
+
+  inline TransactionSnapshot::~TransactionSnapshot() {
+    Details::StaticTransaction::get_snapshot() = m_previous;
+  }
+}
+
+#endif
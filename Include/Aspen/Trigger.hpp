@@ -1,6 +1,9 @@
 #ifndef ASPEN_TRIGGER_HPP
 #define ASPEN_TRIGGER_HPP
-#include <functional>
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <type_traits>
 #include <utility>
 #include "Aspen/Python/DllExports.hpp"
 
@@ -19,12 +22,16 @@ namespace Details {
 #endif
 }
 
-  /** Used to indicate an asynchronous update available in a reactor. */
+  /**
+   * Used to indicate an asynchronous update available in a reactor. The
+   * callback is stored inline, so constructing and signalling a Trigger never
+   * allocates.
+   */
   class Trigger {
     public:
 
-      /** Type of callback used to indicate an update is available. */
-      using Slot = std::function<void ()>;
+      /** The maximum size of a callback stored by a Trigger. */
+      static constexpr auto SLOT_SIZE = 4 * sizeof(void*);
 
       /** Returns the Trigger currently being used. */
       static Trigger* get_trigger() noexcept;
@@ -46,15 +53,25 @@ namespace Details {
 
       /**
        * Constructs a Trigger.
-       * @param slot The function to call when an update is available.
+       * @param slot The function to call when an update is available, at most
+       *        SLOT_SIZE bytes.
        */
-      explicit Trigger(Slot slot);
+      template<typename F> requires
+        (!std::same_as<std::remove_cvref_t<F>, Trigger>) &&
+        std::invocable<std::remove_cvref_t<F>&>
+      explicit Trigger(F&& slot);
+
+      ~Trigger();
 
       /** Signals an update is available. */
       void signal() noexcept;
 
     private:
-      Slot m_slot;
+      using Invoker = void (*)(void*);
+      using Destructor = void (*)(void*) noexcept;
+      alignas(std::max_align_t) std::byte m_slot[SLOT_SIZE];
+      Invoker m_invoker;
+      Destructor m_destructor;
 
       Trigger(const Trigger&) = delete;
       Trigger(Trigger&&) = delete;
@@ -77,11 +94,30 @@ namespace Details {
   inline Trigger::Trigger()
     : Trigger([] {}) {}
 
-  inline Trigger::Trigger(Slot slot)
-    : m_slot(std::move(slot)) {}
+  template<typename F> requires
+    (!std::same_as<std::remove_cvref_t<F>, Trigger>) &&
+    std::invocable<std::remove_cvref_t<F>&>
+  Trigger::Trigger(F&& slot) {
+    using Slot = std::remove_cvref_t<F>;
+    static_assert(sizeof(Slot) <= SLOT_SIZE,
+      "The slot is too large to store within a Trigger.");
+    static_assert(alignof(Slot) <= alignof(std::max_align_t),
+      "The slot is over-aligned.");
+    ::new(static_cast<void*>(m_slot)) Slot(std::forward<F>(slot));
+    m_invoker = [] (void* slot) {
+      (*static_cast<Slot*>(slot))();
+    };
+    m_destructor = [] (void* slot) noexcept {
+      static_cast<Slot*>(slot)->~Slot();
+    };
+  }
+
+  inline Trigger::~Trigger() {
+    m_destructor(m_slot);
+  }
 
   inline void Trigger::signal() noexcept {
-    m_slot();
+    m_invoker(m_slot);
   }
 }
 
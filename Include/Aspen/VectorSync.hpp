@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 #include "Aspen/CommitHandler.hpp"
+#include "Aspen/CommitPool.hpp"
 #include "Aspen/Reactor.hpp"
 #include "Aspen/State.hpp"
 #include "Aspen/Sync.hpp"
@@ -47,6 +48,18 @@ namespace Details {
        */
       VectorSync(Type& value, std::vector<R> reactors);
 
+      /**
+       * Constructs a VectorSync that commits its reactors in parallel, which
+       * requires that no two reactors share a child.
+       * @param value The vector to keep synchronized, which must outlive this
+       *        reactor and whose elements must not be reallocated.
+       * @param reactors The vector of reactors used to synchronize the
+       *        <i>value</i>.
+       * @param pool The CommitPool used to commit the reactors, which must
+       *        outlive this reactor.
+       */
+      VectorSync(Type& value, std::vector<R> reactors, CommitPool& pool);
+
       /**
        * Returns the exception thrown by the lowest indexed reactor currently
        * in an exception state, or nullptr for none.
@@ -68,26 +81,42 @@ namespace Details {
       Type* m_value;
       CommitHandler<Element> m_reactors;
 
+      static std::vector<Element> make_elements(
+        Type& value, std::vector<R>& reactors);
       std::size_t find_exception() const noexcept;
   };
 
   template<IsReactor R, typename V>
   VectorSync<R, V>::VectorSync(Type& value, std::vector<R> reactors)
-    : m_value(&value),
-      m_reactors([&] {
-        value.resize(reactors.size());
-        auto elements = std::vector<Element>();
-        elements.reserve(reactors.size());
-        for(auto i = std::size_t(0); i != reactors.size(); ++i) {
-          elements.push_back(Element(value[i], std::move(reactors[i])));
-        }
-        return elements;
-      }()) {
+      : m_value(&value),
+        m_reactors(make_elements(value, reactors)) {
+    if constexpr(!is_noexcept) {
+      this->m_has_exception.resize(m_reactors.size());
+    }
+  }
+
+  template<IsReactor R, typename V>
+  VectorSync<R, V>::VectorSync(
+      Type& value, std::vector<R> reactors, CommitPool& pool)
+      : m_value(&value),
+        m_reactors(make_elements(value, reactors), pool) {
     if constexpr(!is_noexcept) {
       this->m_has_exception.resize(m_reactors.size());
     }
   }
 
+  template<IsReactor R, typename V>
+  std::vector<typename VectorSync<R, V>::Element>
+      VectorSync<R, V>::make_elements(Type& value, std::vector<R>& reactors) {
+    value.resize(reactors.size());
+    auto elements = std::vector<Element>();
+    elements.reserve(reactors.size());
+    for(auto i = std::size_t(0); i != reactors.size(); ++i) {
+      elements.push_back(Element(value[i], std::move(reactors[i])));
+    }
+    return elements;
+  }
+
   template<IsReactor R, typename V>
   std::size_t VectorSync<R, V>::find_exception() const noexcept {
     if constexpr(!is_noexcept) {
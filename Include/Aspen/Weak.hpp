@@ -124,16 +124,15 @@ namespace Aspen {
 
   template<IsReactor R>
   std::optional<Shared<R>> Weak<R>::lock() const noexcept {
-    auto reactor = m_evaluator->m_reactor.lock();
-    if(!reactor) {
+    if(!m_evaluator->acquire()) {
       return std::nullopt;
     }
-    return Shared(m_evaluator, std::move(reactor));
+    return Shared<Reactor>(m_evaluator);
   }
 
   template<IsReactor R>
   State Weak<R>::commit(std::uint64_t sequence) noexcept {
-    auto reactor = m_evaluator->m_reactor.lock();
+    auto reactor = m_evaluator->acquire();
     if(!reactor) {
       if(m_evaluator->m_evaluation &&
           (m_last_evaluation < m_evaluator->m_released_evaluation ||
@@ -147,6 +146,7 @@ namespace Aspen {
     auto current = CommitFlag::get_current();
     auto state = Shared<Reactor>::commit_state(
       sequence, *reactor, *m_evaluator, m_last_evaluation, current);
+    m_evaluator->remove_reference();
     if(has_evaluation(state)) {
       m_consumed = m_evaluator->m_evaluated;
     }
@@ -161,8 +161,7 @@ namespace Aspen {
     if(m_evaluator->m_evaluation) {
       return **m_evaluator->m_evaluation;
     }
-    auto reactor = m_evaluator->m_reactor.lock();
-    return reactor->eval();
+    return m_evaluator->m_reactor->eval();
   }
 
   template<IsReactor R>
@@ -0,0 +1,476 @@
+#ifndef ASPEN_BENCHMARKS_HPP
+#define ASPEN_BENCHMARKS_HPP
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/State.hpp"
+
+namespace Aspen::Benchmarks {
+
+  /**
+   * Controls the iterations of a single benchmark run and measures the time
+   * taken to perform them, modeled after Google Benchmark's State.
+   */
+  class BenchmarkState {
+    public:
+
+      /**
+       * Constructs a BenchmarkState.
+       * @param iterations The number of iterations to perform.
+       * @param arguments The arguments the benchmark is run with.
+       */
+      BenchmarkState(
+        std::int64_t iterations, std::vector<std::int64_t> arguments);
+
+      /** Returns the argument at the specified index. */
+      std::int64_t range(std::size_t index = 0) const;
+
+      /** Returns the number of iterations to perform. */
+      std::int64_t get_iterations() const noexcept;
+
+      /**
+       * Returns <code>true</code> iff another iteration is to be performed,
+       * starting the timer on the first call and stopping it on the last.
+       */
+      bool keep_running();
+
+      /** Stops the timer, excluding the following work from the results. */
+      void pause_timing();
+
+      /** Resumes the timer after a call to pause_timing. */
+      void resume_timing();
+
+      /**
+       * Records the time taken by the current iteration, used in place of the
+       * timer by benchmarks registered with use_manual_time.
+       * @param duration The time taken by the current iteration.
+       */
+      void set_iteration_time(std::chrono::nanoseconds duration) noexcept;
+
+      /**
+       * Sets the number of items processed across all iterations, reported as
+       * a rate.
+       */
+      void set_items_processed(std::int64_t items) noexcept;
+
+      /** Returns the time measured by the timer. */
+      std::chrono::nanoseconds get_real_time() const noexcept;
+
+      /** Returns the processor time measured by the timer. */
+      std::chrono::nanoseconds get_cpu_time() const noexcept;
+
+      /** Returns the sum of all times recorded by set_iteration_time. */
+      std::chrono::nanoseconds get_manual_time() const noexcept;
+
+      /** Returns the number of items processed. */
+      std::int64_t get_items_processed() const noexcept;
+
+    private:
+      std::int64_t m_iterations;
+      std::int64_t m_remaining;
+      std::vector<std::int64_t> m_arguments;
+      std::chrono::steady_clock::time_point m_start;
+      std::clock_t m_cpu_start;
+      std::chrono::nanoseconds m_real_time;
+      std::chrono::nanoseconds m_cpu_time;
+      std::chrono::nanoseconds m_manual_time;
+      std::int64_t m_items_processed;
+      bool m_is_running;
+      bool m_has_started;
+  };
+
+  /** Stores a registered benchmark and the arguments to run it with. */
+  struct Benchmark {
+
+    /** The name of the benchmark. */
+    std::string m_name;
+
+    /** The function performing the benchmark. */
+    std::function<void (BenchmarkState&)> m_function;
+
+    /** The list of arguments to run the benchmark with. */
+    std::vector<std::vector<std::int64_t>> m_arguments;
+
+    /** Whether the benchmark reports its own iteration times. */
+    bool m_use_manual_time;
+
+    /**
+     * Adds a run with a single argument.
+     * @param argument The argument to run the benchmark with.
+     */
+    Benchmark& arg(std::int64_t argument);
+
+    /**
+     * Adds a run with a list of arguments.
+     * @param arguments The arguments to run the benchmark with.
+     */
+    Benchmark& args(std::vector<std::int64_t> arguments);
+
+    /** Reports the times set by BenchmarkState::set_iteration_time. */
+    Benchmark& use_manual_time();
+  };
+
+  /** Returns every registered benchmark. */
+  inline std::vector<std::unique_ptr<Benchmark>>& get_benchmarks() {
+    static auto benchmarks = std::vector<std::unique_ptr<Benchmark>>();
+    return benchmarks;
+  }
+
+  /**
+   * Registers a benchmark.
+   * @param name The name of the benchmark.
+   * @param function The function performing the benchmark.
+   * @return The registered benchmark.
+   */
+  inline Benchmark& register_benchmark(
+      std::string name, std::function<void (BenchmarkState&)> function) {
+    auto benchmark = std::make_unique<Benchmark>();
+    benchmark->m_name = std::move(name);
+    benchmark->m_function = std::move(function);
+    benchmark->m_use_manual_time = false;
+    auto& benchmarks = get_benchmarks();
+    benchmarks.push_back(std::move(benchmark));
+    return *benchmarks.back();
+  }
+
+  /**
+   * Prevents the compiler from optimizing away the computation of a value.
+   * @param value The value to keep.
+   */
+  template<typename T>
+  void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile auto sink = static_cast<const void*>(nullptr);
+    sink = &value;
+#endif
+  }
+
+  /**
+   * Commits a reactor within a CommitFlag and advances the sequence.
+   * @param reactor The reactor to commit.
+   * @param flag The CommitFlag to commit the <i>reactor</i> within.
+   * @param sequence The sequence to commit with, incremented afterwards.
+   * @return The State returned by the <i>reactor</i>.
+   */
+  template<typename R>
+  State commit(R& reactor, CommitFlag& flag, std::uint64_t& sequence) {
+    flag.clear();
+    auto scope = CommitFlagScope(flag);
+    return reactor.commit(sequence++);
+  }
+
+  inline BenchmarkState::BenchmarkState(
+    std::int64_t iterations, std::vector<std::int64_t> arguments)
+    : m_iterations(iterations),
+      m_remaining(iterations),
+      m_arguments(std::move(arguments)),
+      m_cpu_start(0),
+      m_real_time(0),
+      m_cpu_time(0),
+      m_manual_time(0),
+      m_items_processed(0),
+      m_is_running(false),
+      m_has_started(false) {}
+
+  inline std::int64_t BenchmarkState::range(std::size_t index) const {
+    return m_arguments.at(index);
+  }
+
+  inline std::int64_t BenchmarkState::get_iterations() const noexcept {
+    return m_iterations;
+  }
+
+  inline bool BenchmarkState::keep_running() {
+    if(!m_has_started) {
+      m_has_started = true;
+      resume_timing();
+    }
+    if(m_remaining == 0) {
+      if(m_is_running) {
+        pause_timing();
+      }
+      return false;
+    }
+    --m_remaining;
+    return true;
+  }
+
+  inline void BenchmarkState::pause_timing() {
+    m_real_time += std::chrono::steady_clock::now() - m_start;
+    m_cpu_time += std::chrono::nanoseconds(
+      (std::clock() - m_cpu_start) * (1000000000 / CLOCKS_PER_SEC));
+    m_is_running = false;
+  }
+
+  inline void BenchmarkState::resume_timing() {
+    m_is_running = true;
+    m_cpu_start = std::clock();
+    m_start = std::chrono::steady_clock::now();
+  }
+
+  inline void BenchmarkState::set_iteration_time(
+      std::chrono::nanoseconds duration) noexcept {
+    m_manual_time += duration;
+  }
+
+  inline void BenchmarkState::set_items_processed(
+      std::int64_t items) noexcept {
+    m_items_processed = items;
+  }
+
+  inline std::chrono::nanoseconds
+      BenchmarkState::get_real_time() const noexcept {
+    return m_real_time;
+  }
+
+  inline std::chrono::nanoseconds
+      BenchmarkState::get_cpu_time() const noexcept {
+    return m_cpu_time;
+  }
+
+  inline std::chrono::nanoseconds
+      BenchmarkState::get_manual_time() const noexcept {
+    return m_manual_time;
+  }
+
+  inline std::int64_t BenchmarkState::get_items_processed() const noexcept {
+    return m_items_processed;
+  }
+
+  inline Benchmark& Benchmark::arg(std::int64_t argument) {
+    return args({argument});
+  }
+
+  inline Benchmark& Benchmark::args(std::vector<std::int64_t> arguments) {
+    m_arguments.push_back(std::move(arguments));
+    return *this;
+  }
+
+  inline Benchmark& Benchmark::use_manual_time() {
+    m_use_manual_time = true;
+    return *this;
+  }
+
+namespace Details {
+  struct BenchmarkResult {
+    std::string m_name;
+    std::string m_run_name;
+    std::int64_t m_iterations;
+    double m_real_time;
+    double m_cpu_time;
+    std::optional<double> m_items_per_second;
+  };
+
+  inline std::string escape_json(std::string_view value) {
+    auto escaped = std::string();
+    for(auto c : value) {
+      if(c == '"' || c == '\\') {
+        escaped += '\\';
+      }
+      escaped += c;
+    }
+    return escaped;
+  }
+
+  inline void print_json(
+      std::ostream& sink, const std::vector<BenchmarkResult>& results) {
+    auto now = std::time(nullptr);
+    auto date = std::string(32, '\0');
+    date.resize(std::strftime(
+      date.data(), date.size(), "%Y-%m-%dT%H:%M:%S", std::localtime(&now)));
+    sink << "{\n  \"context\": {\n    \"date\": \"" << date << "\",\n" <<
+      "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n" <<
+#ifdef NDEBUG
+      "    \"library_build_type\": \"release\"\n" <<
+#else
+      "    \"library_build_type\": \"debug\"\n" <<
+#endif
+      "  },\n  \"benchmarks\": [";
+    for(auto i = std::size_t(0); i != results.size(); ++i) {
+      auto& result = results[i];
+      if(i != 0) {
+        sink << ',';
+      }
+      sink << "\n    {\n      \"name\": \"" << escape_json(result.m_name) <<
+        "\",\n      \"run_name\": \"" << escape_json(result.m_run_name) <<
+        "\",\n      \"run_type\": \"iteration\",\n      \"iterations\": " <<
+        result.m_iterations << ",\n      \"real_time\": " <<
+        std::setprecision(17) << result.m_real_time <<
+        ",\n      \"cpu_time\": " << result.m_cpu_time <<
+        ",\n      \"time_unit\": \"ns\"";
+      if(result.m_items_per_second) {
+        sink << ",\n      \"items_per_second\": " << *result.m_items_per_second;
+      }
+      sink << "\n    }";
+    }
+    sink << "\n  ]\n}\n";
+  }
+
+  inline void print_console(std::ostream& sink, const BenchmarkResult& result) {
+    sink << std::left << std::setw(48) << result.m_name << std::right <<
+      std::fixed << std::setprecision(1) << std::setw(14) <<
+      result.m_real_time << " ns" << std::setw(14) << result.m_cpu_time <<
+      " ns" << std::setw(12) << result.m_iterations;
+    if(result.m_items_per_second) {
+      sink << std::setprecision(0) << std::setw(16) <<
+        *result.m_items_per_second << " items/s";
+    }
+    sink << std::endl;
+  }
+
+  inline BenchmarkResult run_benchmark(const Benchmark& benchmark,
+      const std::vector<std::int64_t>& arguments,
+      std::chrono::duration<double> min_time) {
+    auto name = benchmark.m_name;
+    for(auto argument : arguments) {
+      name += '/' + std::to_string(argument);
+    }
+    if(benchmark.m_use_manual_time) {
+      name += "/manual_time";
+    }
+    auto iterations = std::int64_t(1);
+    while(true) {
+      auto state = BenchmarkState(iterations, arguments);
+      benchmark.m_function(state);
+      auto time = std::chrono::duration<double>([&] {
+        if(benchmark.m_use_manual_time) {
+          return state.get_manual_time();
+        }
+        return state.get_real_time();
+      }());
+      if(time >= min_time || iterations >= 1000000000) {
+        auto result = BenchmarkResult();
+        result.m_name = name;
+        result.m_run_name = name;
+        result.m_iterations = iterations;
+        result.m_real_time = 1e9 * time.count() / iterations;
+        result.m_cpu_time = std::chrono::duration<double, std::nano>(
+          state.get_cpu_time()).count() / iterations;
+        if(state.get_items_processed() != 0 && time.count() > 0) {
+          result.m_items_per_second =
+            state.get_items_processed() / time.count();
+        }
+        return result;
+      }
+      auto multiplier = [&] {
+        if(time.count() <= 0) {
+          return 10.;
+        }
+        return std::clamp(1.4 * min_time / time, 2., 10.);
+      }();
+      iterations = static_cast<std::int64_t>(iterations * multiplier);
+    }
+  }
+}
+
+  /**
+   * Runs every registered benchmark matching the command line, accepting
+   * <code>--benchmark_filter=REGEX</code>,
+   * <code>--benchmark_format=console|json</code>,
+   * <code>--benchmark_out=PATH</code> to write JSON results to a file,
+   * <code>--benchmark_min_time=SECONDS</code> and
+   * <code>--benchmark_list_tests</code>.
+   * @param argc The number of command line arguments.
+   * @param argv The command line arguments.
+   * @return The process exit code.
+   */
+  inline int run_benchmarks(int argc, const char* const* argv) {
+    auto filter = std::regex(".*");
+    auto is_json = false;
+    auto is_listing = false;
+    auto out = std::string();
+    auto min_time = std::chrono::duration<double>(0.5);
+    for(auto i = 1; i < argc; ++i) {
+      auto argument = std::string_view(argv[i]);
+      auto value = [&] (std::string_view flag) -> std::optional<std::string> {
+        if(argument.starts_with(flag) && argument.size() > flag.size() &&
+            argument[flag.size()] == '=') {
+          return std::string(argument.substr(flag.size() + 1));
+        }
+        return std::nullopt;
+      };
+      if(auto pattern = value("--benchmark_filter")) {
+        filter = std::regex(*pattern);
+      } else if(auto format = value("--benchmark_format")) {
+        is_json = *format == "json";
+      } else if(auto path = value("--benchmark_out")) {
+        out = *path;
+      } else if(auto seconds = value("--benchmark_min_time")) {
+        min_time = std::chrono::duration<double>(std::stod(*seconds));
+      } else if(argument == "--benchmark_list_tests") {
+        is_listing = true;
+      } else {
+        std::cerr << "Unknown argument: " << argument << std::endl;
+        return 1;
+      }
+    }
+    auto results = std::vector<Details::BenchmarkResult>();
+    for(auto& benchmark : get_benchmarks()) {
+      auto runs = benchmark->m_arguments;
+      if(runs.empty()) {
+        runs.emplace_back();
+      }
+      for(auto& arguments : runs) {
+        auto name = benchmark->m_name;
+        for(auto argument : arguments) {
+          name += '/' + std::to_string(argument);
+        }
+        if(!std::regex_search(name, filter)) {
+          continue;
+        }
+        if(is_listing) {
+          std::cout << name << std::endl;
+          continue;
+        }
+        results.push_back(
+          Details::run_benchmark(*benchmark, arguments, min_time));
+        if(!is_json) {
+          Details::print_console(std::cout, results.back());
+        }
+      }
+    }
+    if(is_json && !is_listing) {
+      Details::print_json(std::cout, results);
+    }
+    if(!out.empty()) {
+      auto file = std::ofstream(out);
+      if(!file) {
+        std::cerr << "Unable to open: " << out << std::endl;
+        return 1;
+      }
+      Details::print_json(file, results);
+    }
+    return 0;
+  }
+}
+
+#define ASPEN_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define ASPEN_BENCHMARK_CONCAT(a, b) ASPEN_BENCHMARK_CONCAT_IMPL(a, b)
+
+/**
+ * Registers a function taking a BenchmarkState& as a benchmark, returning the
+ * Benchmark so that arguments can be added.
+ */
+#define ASPEN_BENCHMARK(function)                                              \
+  [[maybe_unused]] static auto& ASPEN_BENCHMARK_CONCAT(                        \
+    aspen_benchmark_, __LINE__) =                                              \
+    ::Aspen::Benchmarks::register_benchmark(#function, function)
+
+#endif
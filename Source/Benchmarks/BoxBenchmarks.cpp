@@ -0,0 +1,46 @@
+#include <cstdint>
+#include <vector>
+#include "Aspen/Box.hpp"
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Constant.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Shared.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  void box_construction(BenchmarkState& state) {
+    auto boxes = std::vector<Box<int>>();
+    boxes.reserve(state.range(0));
+    while(state.keep_running()) {
+      for(auto i = std::int64_t(0); i != state.range(0); ++i) {
+        boxes.push_back(box(constant(static_cast<int>(i))));
+      }
+      do_not_optimize(boxes.data());
+      boxes.clear();
+    }
+    state.set_items_processed(state.get_iterations() * state.range(0));
+  }
+
+  void box_commit(BenchmarkState& state) {
+    auto source = Shared(Cell(0));
+    auto reactor = box(lift([] (int value) {
+      return value + 1;
+    }, source));
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(reactor, flag, sequence);
+    while(state.keep_running()) {
+      source->set(static_cast<int>(sequence));
+      commit(reactor, flag, sequence);
+      do_not_optimize(reactor.eval());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+}
+
+ASPEN_BENCHMARK(box_construction).arg(100).arg(10000);
+ASPEN_BENCHMARK(box_commit);
@@ -0,0 +1,54 @@
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <thread>
+#include "Aspen/CommitFlag.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  void commit_flag_raise(BenchmarkState& state) {
+    auto depth = state.range(0);
+    auto flags = std::deque<CommitFlag>(depth);
+    for(auto i = std::size_t(1); i < flags.size(); ++i) {
+      flags[i].set_parent(&flags[i - 1]);
+    }
+    while(state.keep_running()) {
+      for(auto& flag : flags) {
+        flag.clear();
+      }
+      flags.back().raise();
+    }
+    do_not_optimize(flags.front().is_raised());
+    state.set_items_processed(state.get_iterations());
+  }
+
+  void commit_flag_hub_raise(BenchmarkState& state) {
+    auto hub = CommitFlag();
+    auto parents = std::deque<CommitFlag>(state.range(0));
+    for(auto& parent : parents) {
+      hub.add_parent(parent);
+    }
+    auto is_running = std::atomic_bool(true);
+    auto clearer = std::thread([&] {
+      while(is_running.load(std::memory_order_relaxed)) {
+        hub.clear();
+        for(auto& parent : parents) {
+          parent.clear();
+        }
+        std::this_thread::yield();
+      }
+    });
+    while(state.keep_running()) {
+      hub.raise();
+    }
+    is_running.store(false, std::memory_order_relaxed);
+    clearer.join();
+    state.set_items_processed(state.get_iterations());
+  }
+}
+
+ASPEN_BENCHMARK(commit_flag_raise).arg(1).arg(8).arg(64);
+ASPEN_BENCHMARK(commit_flag_hub_raise).arg(10).arg(1000);
@@ -0,0 +1,170 @@
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <vector>
+#include "Aspen/Box.hpp"
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/CommitHandler.hpp"
+#include "Aspen/CommitPool.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/LockFreeQueue.hpp"
+#include "Aspen/Shared.hpp"
+#include "Aspen/SlotLayout.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  constexpr auto CONTENDED_CHILDREN = std::int64_t(64);
+  constexpr auto CONTENDED_PRODUCERS = std::int64_t(8);
+
+  auto make_cells(std::int64_t count) {
+    auto cells = std::vector<Shared<Cell<int>>>();
+    cells.reserve(count);
+    for(auto i = std::int64_t(0); i != count; ++i) {
+      cells.push_back(Shared(Cell(0)));
+    }
+    return cells;
+  }
+
+  void commit_handler_sparse_raise(BenchmarkState& state) {
+    auto cells = make_cells(state.range(0));
+    auto handler = CommitHandler(cells);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    auto index = std::size_t(0);
+    while(state.keep_running()) {
+      cells[index]->set(static_cast<int>(sequence));
+      index = (index + 7919) % cells.size();
+      commit(handler, flag, sequence);
+      do_not_optimize(handler.get_evaluated());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+
+  void commit_handler_dense_raise(BenchmarkState& state) {
+    auto cells = make_cells(state.range(0));
+    auto handler = CommitHandler(cells);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    while(state.keep_running()) {
+      for(auto& cell : cells) {
+        cell->set(static_cast<int>(sequence));
+      }
+      commit(handler, flag, sequence);
+      do_not_optimize(handler.get_evaluated());
+    }
+    state.set_items_processed(state.get_iterations() * cells.size());
+  }
+
+  void commit_handler_heavy_children(BenchmarkState& state) {
+    auto cells = make_cells(state.range(0));
+    auto children = std::vector<Box<double>>();
+    for(auto& cell : cells) {
+      children.push_back(box(lift([] (int value) {
+        auto sum = 0.0;
+        for(auto i = 0; i != 2000; ++i) {
+          sum += std::sqrt(static_cast<double>(value + i));
+        }
+        return sum;
+      }, cell)));
+    }
+    auto pool = std::optional<CommitPool>();
+    if(state.range(1) != 0) {
+      pool.emplace(state.range(1));
+    }
+    auto handler = pool ? CommitHandler(std::move(children), *pool) :
+      CommitHandler(std::move(children));
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    while(state.keep_running()) {
+      for(auto& cell : cells) {
+        cell->set(static_cast<int>(sequence));
+      }
+      commit(handler, flag, sequence);
+      do_not_optimize(handler.get_evaluated());
+    }
+    state.set_items_processed(state.get_iterations() * cells.size());
+  }
+
+  void commit_handler_sparse_pool(BenchmarkState& state) {
+    auto cells = make_cells(1000);
+    auto pool = CommitPool(state.range(1));
+    auto handler = CommitHandler(cells, pool);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    auto index = std::size_t(0);
+    while(state.keep_running()) {
+      for(auto i = std::int64_t(0); i != state.range(0); ++i) {
+        cells[index]->set(static_cast<int>(sequence));
+        index = (index + 7919) % cells.size();
+      }
+      commit(handler, flag, sequence);
+      do_not_optimize(handler.get_evaluated());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+
+  template<typename L>
+  void raise_contended(BenchmarkState& state) {
+    auto queues = std::vector<Shared<LockFreeQueue<int>>>();
+    for(auto i = std::int64_t(0); i != CONTENDED_CHILDREN; ++i) {
+      queues.push_back(Shared(LockFreeQueue<int>()));
+    }
+    auto handler = CommitHandler<Shared<LockFreeQueue<int>>, L>(queues);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    auto pushes = state.get_iterations() / CONTENDED_CHILDREN + 1;
+    auto total = CONTENDED_CHILDREN * pushes;
+    auto start = std::chrono::steady_clock::now();
+    auto producers = std::vector<std::thread>();
+    for(auto i = std::int64_t(0); i != CONTENDED_PRODUCERS; ++i) {
+      producers.emplace_back([&, i] {
+        for(auto j = std::int64_t(0); j != pushes; ++j) {
+          for(auto k = i; k < CONTENDED_CHILDREN; k += CONTENDED_PRODUCERS) {
+            queues[k]->push(static_cast<int>(j));
+          }
+        }
+      });
+    }
+    auto count = std::int64_t(0);
+    while(count != total) {
+      commit(handler, flag, sequence);
+      for(auto index : handler.get_evaluated()) {
+        do_not_optimize(handler.get(index).eval());
+        ++count;
+      }
+    }
+    for(auto& producer : producers) {
+      producer.join();
+    }
+    state.set_iteration_time(std::chrono::steady_clock::now() - start);
+    state.set_items_processed(total);
+  }
+
+  void commit_handler_packed_contention(BenchmarkState& state) {
+    raise_contended<PackedSlotLayout>(state);
+  }
+
+  void commit_handler_padded_contention(BenchmarkState& state) {
+    raise_contended<PaddedSlotLayout<>>(state);
+  }
+}
+
+ASPEN_BENCHMARK(commit_handler_sparse_raise).arg(10).arg(1000).arg(100000);
+ASPEN_BENCHMARK(commit_handler_dense_raise).arg(10).arg(1000).arg(100000);
+ASPEN_BENCHMARK(commit_handler_heavy_children).
+  args({256, 0}).args({256, 1}).args({256, 3});
+ASPEN_BENCHMARK(commit_handler_sparse_pool).
+  args({2, 1}).args({2, 15}).args({64, 15});
+ASPEN_BENCHMARK(commit_handler_packed_contention).use_manual_time();
+ASPEN_BENCHMARK(commit_handler_padded_contention).use_manual_time();
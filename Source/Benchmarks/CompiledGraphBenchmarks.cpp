@@ -0,0 +1,64 @@
+#include <cstddef>
+#include <cstdint>
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/CompiledGraph.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Shared.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  constexpr auto DEPTH = std::size_t(24);
+
+  int increment(int x) {
+    return x + 1;
+  }
+
+  template<std::size_t N>
+  auto make_chain(auto reactor) {
+    if constexpr(N == 0) {
+      return reactor;
+    } else {
+      return make_chain<N - 1>(lift(increment, std::move(reactor)));
+    }
+  }
+
+  void lift_deep_chain(BenchmarkState& state) {
+    auto cell = Shared(Cell(0));
+    auto reactor = make_chain<DEPTH>(cell);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(reactor, flag, sequence);
+    while(state.keep_running()) {
+      cell->set(static_cast<int>(sequence));
+      commit(reactor, flag, sequence);
+      do_not_optimize(reactor.eval());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+
+  void compiled_deep_chain(BenchmarkState& state) {
+    auto cell = Shared(Cell(0));
+    auto builder = GraphBuilder();
+    auto node = builder.source(cell);
+    for(auto i = std::size_t(0); i != DEPTH; ++i) {
+      node = builder.lift(increment, node);
+    }
+    auto reactor = builder.compile(node);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(reactor, flag, sequence);
+    while(state.keep_running()) {
+      cell->set(static_cast<int>(sequence));
+      commit(reactor, flag, sequence);
+      do_not_optimize(reactor.eval());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+}
+
+ASPEN_BENCHMARK(lift_deep_chain);
+ASPEN_BENCHMARK(compiled_deep_chain);
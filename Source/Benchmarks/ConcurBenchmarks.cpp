@@ -0,0 +1,55 @@
+#include <cstdint>
+#include <vector>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Concur.hpp"
+#include "Aspen/Constant.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  void concur_churn(BenchmarkState& state) {
+    auto producer = Shared(Queue<SharedBox<int>>());
+    auto residents = std::vector<Shared<Queue<int>>>();
+    for(auto i = std::int64_t(0); i != state.range(0); ++i) {
+      residents.push_back(Shared(Queue<int>()));
+      producer->push(shared_box(residents.back()));
+    }
+    auto reactor = concur(producer);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    while(has_continuation(commit(reactor, flag, sequence))) {}
+    while(state.keep_running()) {
+      producer->push(shared_box(constant(static_cast<int>(sequence))));
+      while(has_continuation(commit(reactor, flag, sequence))) {}
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+
+  void concur_sparse_raise(BenchmarkState& state) {
+    auto producer = Shared(Queue<SharedBox<int>>());
+    auto residents = std::vector<Shared<Queue<int>>>();
+    for(auto i = std::int64_t(0); i != state.range(0); ++i) {
+      residents.push_back(Shared(Queue<int>()));
+      producer->push(shared_box(residents.back()));
+    }
+    auto reactor = concur(producer);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    while(has_continuation(commit(reactor, flag, sequence))) {}
+    auto index = std::size_t(0);
+    while(state.keep_running()) {
+      residents[index]->push(static_cast<int>(sequence));
+      index = (index + 7919) % residents.size();
+      while(has_continuation(commit(reactor, flag, sequence))) {}
+      do_not_optimize(reactor.eval());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+}
+
+ASPEN_BENCHMARK(concur_churn).arg(0).arg(1000);
+ASPEN_BENCHMARK(concur_sparse_raise).arg(1000).arg(100000);
@@ -0,0 +1,51 @@
+#include <cstdint>
+#include <utility>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/ConflatingQueue.hpp"
+#include "Aspen/Queue.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  constexpr auto KEYS = 16;
+  constexpr auto BURST = 1024;
+
+  void queue_burst(BenchmarkState& state) {
+    auto queue = Queue<std::pair<int, double>>();
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(queue, flag, sequence);
+    while(state.keep_running()) {
+      for(auto i = 0; i != BURST; ++i) {
+        queue.push(std::pair(i % KEYS, static_cast<double>(i)));
+      }
+      while(has_continuation(commit(queue, flag, sequence))) {
+        do_not_optimize(queue.eval());
+      }
+      do_not_optimize(queue.eval());
+    }
+    state.set_items_processed(state.get_iterations() * BURST);
+  }
+
+  void conflating_queue_burst(BenchmarkState& state) {
+    auto queue = ConflatingQueue<int, double>();
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(queue, flag, sequence);
+    while(state.keep_running()) {
+      for(auto i = 0; i != BURST; ++i) {
+        queue.push(i % KEYS, static_cast<double>(i));
+      }
+      while(has_continuation(commit(queue, flag, sequence))) {
+        do_not_optimize(queue.eval());
+      }
+      do_not_optimize(queue.eval());
+    }
+    state.set_items_processed(state.get_iterations() * BURST);
+  }
+}
+
+ASPEN_BENCHMARK(queue_burst);
+ASPEN_BENCHMARK(conflating_queue_burst);
@@ -0,0 +1,66 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include "Aspen/Executor.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  void executor_wake_up(BenchmarkState& state) {
+    auto queue = Shared(Queue<int>());
+    auto observed = std::atomic_int(-1);
+    auto executor = Executor(lift([&] (int value) {
+      observed.store(value, std::memory_order_release);
+    }, queue), static_cast<WaitStrategy>(state.range(0)));
+    auto runner = std::thread([&] {
+      executor.run_until_complete();
+    });
+    auto value = 0;
+    while(state.keep_running()) {
+      auto start = std::chrono::steady_clock::now();
+      queue->push(value);
+      while(observed.load(std::memory_order_acquire) != value) {}
+      state.set_iteration_time(std::chrono::steady_clock::now() - start);
+      ++value;
+    }
+    queue->set_complete();
+    runner.join();
+  }
+
+  void executor_push(BenchmarkState& state) {
+    auto queue = Shared(Queue<int>());
+    auto count = std::atomic_int(0);
+    auto executor = Executor(lift([&] (int value) {
+      count.fetch_add(1, std::memory_order_relaxed);
+    }, queue), static_cast<WaitStrategy>(state.range(0)));
+    auto runner = std::thread([&] {
+      executor.run_until_complete();
+    });
+    auto value = 0;
+    while(state.keep_running()) {
+      queue->push(value);
+      ++value;
+    }
+    queue->set_complete();
+    runner.join();
+    do_not_optimize(count.load(std::memory_order_relaxed));
+    state.set_items_processed(state.get_iterations());
+  }
+}
+
+ASPEN_BENCHMARK(executor_wake_up).arg(
+  static_cast<std::int64_t>(WaitStrategy::CONDITION_VARIABLE)).arg(
+  static_cast<std::int64_t>(WaitStrategy::BUSY_SPIN)).arg(
+  static_cast<std::int64_t>(WaitStrategy::SPIN_YIELD)).arg(
+  static_cast<std::int64_t>(WaitStrategy::SPIN_WAIT)).use_manual_time();
+ASPEN_BENCHMARK(executor_push).arg(
+  static_cast<std::int64_t>(WaitStrategy::CONDITION_VARIABLE)).arg(
+  static_cast<std::int64_t>(WaitStrategy::BUSY_SPIN)).arg(
+  static_cast<std::int64_t>(WaitStrategy::SPIN_YIELD)).arg(
+  static_cast<std::int64_t>(WaitStrategy::SPIN_WAIT));
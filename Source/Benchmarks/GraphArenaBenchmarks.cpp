@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "Aspen/Box.hpp"
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/CommitHandler.hpp"
+#include "Aspen/GraphArena.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Shared.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  auto build_graph(const Shared<Cell<int>>& source, std::int64_t size) {
+    auto increment = [] (int value) {
+      return value + 1;
+    };
+    auto nodes = std::vector<SharedBox<int>>();
+    nodes.reserve(size);
+    for(auto i = std::int64_t(0); i != size; ++i) {
+      nodes.push_back(
+        shared_box(lift(increment, box(lift(increment, source)))));
+    }
+    return nodes;
+  }
+
+  void build_graph_heap(BenchmarkState& state) {
+    auto source = Shared(Cell(0));
+    while(state.keep_running()) {
+      auto nodes = build_graph(source, state.range(0));
+      do_not_optimize(nodes.data());
+    }
+    state.set_items_processed(state.get_iterations() * state.range(0));
+  }
+
+  void build_graph_arena(BenchmarkState& state) {
+    auto source = Shared(Cell(0));
+    while(state.keep_running()) {
+      auto arena = GraphArena();
+      auto scope = GraphArenaScope(arena);
+      auto nodes = build_graph(source, state.range(0));
+      do_not_optimize(nodes.data());
+    }
+    state.set_items_processed(state.get_iterations() * state.range(0));
+  }
+
+  void commit_graph(BenchmarkState& state, bool use_arena) {
+    auto arena = std::optional<GraphArena>();
+    if(use_arena) {
+      arena.emplace();
+    }
+    auto scope = GraphArenaScope(arena ? &*arena : nullptr);
+    auto source = Shared(Cell(0));
+    auto handler = CommitHandler(build_graph(source, state.range(0)));
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    while(state.keep_running()) {
+      source->set(static_cast<int>(sequence));
+      commit(handler, flag, sequence);
+      do_not_optimize(handler.get_evaluated());
+    }
+    state.set_items_processed(state.get_iterations() * state.range(0));
+  }
+
+  void commit_graph_heap(BenchmarkState& state) {
+    commit_graph(state, false);
+  }
+
+  void commit_graph_arena(BenchmarkState& state) {
+    commit_graph(state, true);
+  }
+}
+
+ASPEN_BENCHMARK(build_graph_heap).arg(100).arg(10000);
+ASPEN_BENCHMARK(build_graph_arena).arg(100).arg(10000);
+ASPEN_BENCHMARK(commit_graph_heap).arg(100).arg(10000);
+ASPEN_BENCHMARK(commit_graph_arena).arg(100).arg(10000);
@@ -0,0 +1,59 @@
+#include <array>
+#include <cstdint>
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Shared.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  void lift_fan_in(BenchmarkState& state) {
+    auto cells = std::array<Shared<Cell<int>>, 8>();
+    for(auto& cell : cells) {
+      cell = Shared(Cell(0));
+    }
+    auto reactor = lift([] (int a, int b, int c, int d, int e, int f, int g,
+        int h) {
+      return a + b + c + d + e + f + g + h;
+    }, cells[0], cells[1], cells[2], cells[3], cells[4], cells[5], cells[6],
+      cells[7]);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(reactor, flag, sequence);
+    while(state.keep_running()) {
+      cells[sequence % cells.size()]->set(static_cast<int>(sequence));
+      commit(reactor, flag, sequence);
+      do_not_optimize(reactor.eval());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+
+  void lift_fan_in_all(BenchmarkState& state) {
+    auto cells = std::array<Shared<Cell<int>>, 8>();
+    for(auto& cell : cells) {
+      cell = Shared(Cell(0));
+    }
+    auto reactor = lift([] (int a, int b, int c, int d, int e, int f, int g,
+        int h) {
+      return a + b + c + d + e + f + g + h;
+    }, cells[0], cells[1], cells[2], cells[3], cells[4], cells[5], cells[6],
+      cells[7]);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(reactor, flag, sequence);
+    while(state.keep_running()) {
+      for(auto& cell : cells) {
+        cell->set(static_cast<int>(sequence));
+      }
+      commit(reactor, flag, sequence);
+      do_not_optimize(reactor.eval());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+}
+
+ASPEN_BENCHMARK(lift_fan_in);
+ASPEN_BENCHMARK(lift_fan_in_all);
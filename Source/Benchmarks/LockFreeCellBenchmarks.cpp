@@ -0,0 +1,69 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/LockFreeCell.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  template<typename C>
+  void set_and_commit(BenchmarkState& state) {
+    auto cell = C(0.0);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(cell, flag, sequence);
+    while(state.keep_running()) {
+      cell.set(static_cast<double>(sequence));
+      commit(cell, flag, sequence);
+      do_not_optimize(cell.eval());
+    }
+    state.set_items_processed(state.get_iterations());
+  }
+
+  template<typename C>
+  void contended_commit(BenchmarkState& state) {
+    auto cell = C(0.0);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    auto is_running = std::atomic_bool(true);
+    auto writer = std::thread([&] {
+      auto value = 0.0;
+      while(is_running.load(std::memory_order_relaxed)) {
+        cell.set(++value);
+      }
+    });
+    while(state.keep_running()) {
+      if(has_evaluation(commit(cell, flag, sequence))) {
+        do_not_optimize(cell.eval());
+      }
+    }
+    is_running.store(false, std::memory_order_relaxed);
+    writer.join();
+    state.set_items_processed(state.get_iterations());
+  }
+
+  void cell_set_commit(BenchmarkState& state) {
+    set_and_commit<Cell<double>>(state);
+  }
+
+  void lock_free_cell_set_commit(BenchmarkState& state) {
+    set_and_commit<LockFreeCell<double>>(state);
+  }
+
+  void cell_contended_commit(BenchmarkState& state) {
+    contended_commit<Cell<double>>(state);
+  }
+
+  void lock_free_cell_contended_commit(BenchmarkState& state) {
+    contended_commit<LockFreeCell<double>>(state);
+  }
+}
+
+ASPEN_BENCHMARK(cell_set_commit);
+ASPEN_BENCHMARK(lock_free_cell_set_commit);
+ASPEN_BENCHMARK(cell_contended_commit);
+ASPEN_BENCHMARK(lock_free_cell_contended_commit);
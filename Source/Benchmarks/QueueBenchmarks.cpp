@@ -0,0 +1,85 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/LockFreeQueue.hpp"
+#include "Aspen/Queue.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  template<typename Q>
+  void produce(BenchmarkState& state, Q& queue, auto&& consume) {
+    auto producer_count = state.range(0);
+    auto pushes = state.get_iterations() / producer_count + 1;
+    auto producers = std::vector<std::thread>();
+    auto start = std::chrono::steady_clock::now();
+    for(auto i = std::int64_t(0); i != producer_count; ++i) {
+      producers.emplace_back([&] {
+        for(auto j = std::int64_t(0); j != pushes; ++j) {
+          if constexpr(requires { queue.push(0); }) {
+            queue.push(static_cast<int>(j));
+          } else {
+            queue.set(static_cast<int>(j));
+          }
+        }
+      });
+    }
+    consume(producer_count * pushes);
+    for(auto& producer : producers) {
+      producer.join();
+    }
+    state.set_iteration_time(std::chrono::steady_clock::now() - start);
+    state.set_items_processed(producer_count * pushes);
+  }
+
+  template<typename Q>
+  void consume_all(BenchmarkState& state) {
+    auto queue = Q();
+    produce(state, queue, [&] (std::int64_t total) {
+      auto flag = CommitFlag();
+      auto sequence = std::uint64_t(0);
+      auto count = std::int64_t(0);
+      while(count != total) {
+        if(has_evaluation(commit(queue, flag, sequence))) {
+          ++count;
+        }
+      }
+    });
+  }
+
+  void queue_producer_contention(BenchmarkState& state) {
+    consume_all<Queue<int>>(state);
+  }
+
+  void lock_free_queue_producer_contention(BenchmarkState& state) {
+    consume_all<LockFreeQueue<int>>(state);
+  }
+
+  void cell_producer_contention(BenchmarkState& state) {
+    auto cell = Cell<int>();
+    auto is_done = std::atomic_bool(false);
+    auto consumer = std::thread([&] {
+      auto flag = CommitFlag();
+      auto sequence = std::uint64_t(0);
+      while(!is_done.load(std::memory_order_relaxed)) {
+        commit(cell, flag, sequence);
+      }
+    });
+    produce(state, cell, [] (std::int64_t) {});
+    is_done.store(true);
+    consumer.join();
+  }
+}
+
+ASPEN_BENCHMARK(queue_producer_contention).arg(1).arg(2).arg(4).
+  use_manual_time();
+ASPEN_BENCHMARK(lock_free_queue_producer_contention).arg(1).arg(2).arg(4).
+  use_manual_time();
+ASPEN_BENCHMARK(cell_producer_contention).arg(1).arg(2).arg(4).
+  use_manual_time();
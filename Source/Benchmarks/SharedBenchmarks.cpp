@@ -0,0 +1,82 @@
+#include <cstdint>
+#include <vector>
+#include "Aspen/Box.hpp"
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/CommitHandler.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Shared.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  void shared_construction(BenchmarkState& state) {
+    auto nodes = std::vector<Shared<Cell<int>>>();
+    nodes.reserve(state.range(0));
+    while(state.keep_running()) {
+      for(auto i = std::int64_t(0); i != state.range(0); ++i) {
+        nodes.emplace_back(Cell(static_cast<int>(i)));
+      }
+      do_not_optimize(nodes.data());
+      nodes.clear();
+    }
+    state.set_items_processed(state.get_iterations() * state.range(0));
+  }
+
+  void shared_lattice(BenchmarkState& state) {
+    auto source = Shared(Cell(0));
+    auto add = [] (int left, int right) {
+      return left + right;
+    };
+    auto layer = std::vector<SharedBox<int>>();
+    for(auto i = std::int64_t(0); i != state.range(0); ++i) {
+      layer.push_back(shared_box(source));
+    }
+    for(auto depth = std::int64_t(1); depth != state.range(1); ++depth) {
+      auto next = std::vector<SharedBox<int>>();
+      for(auto i = std::size_t(0); i != layer.size(); ++i) {
+        next.push_back(
+          shared_box(lift(add, layer[i], layer[(i + 1) % layer.size()])));
+      }
+      layer = std::move(next);
+    }
+    auto handler = CommitHandler(std::move(layer));
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    while(state.keep_running()) {
+      source->set(static_cast<int>(sequence));
+      commit(handler, flag, sequence);
+      do_not_optimize(handler.get_evaluated());
+    }
+    state.set_items_processed(
+      state.get_iterations() * state.range(0) * state.range(1));
+  }
+
+  void shared_fan_out(BenchmarkState& state) {
+    auto source = Shared(Cell(0));
+    auto increment = [] (int value) {
+      return value + 1;
+    };
+    auto observers = std::vector<decltype(lift(increment, source))>();
+    for(auto i = std::int64_t(0); i != state.range(0); ++i) {
+      observers.push_back(lift(increment, source));
+    }
+    auto handler = CommitHandler(std::move(observers));
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    commit(handler, flag, sequence);
+    while(state.keep_running()) {
+      source->set(static_cast<int>(sequence));
+      commit(handler, flag, sequence);
+      do_not_optimize(handler.get_evaluated());
+    }
+    state.set_items_processed(state.get_iterations() * state.range(0));
+  }
+}
+
+ASPEN_BENCHMARK(shared_construction).arg(100).arg(10000);
+ASPEN_BENCHMARK(shared_lattice).args({16, 8}).args({256, 8});
+ASPEN_BENCHMARK(shared_fan_out).arg(1).arg(10).arg(100).arg(1000);
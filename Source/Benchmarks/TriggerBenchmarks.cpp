@@ -0,0 +1,39 @@
+#include <cstdint>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Trigger.hpp"
+#include "Benchmarks.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Benchmarks;
+
+namespace {
+  void trigger_signal(BenchmarkState& state) {
+    auto count = std::uint64_t(0);
+    auto trigger = Trigger([&] {
+      ++count;
+    });
+    while(state.keep_running()) {
+      trigger.signal();
+    }
+    do_not_optimize(count);
+    state.set_items_processed(state.get_iterations());
+  }
+
+  void trigger_root_raise(BenchmarkState& state) {
+    auto count = std::uint64_t(0);
+    auto trigger = Trigger([&] {
+      ++count;
+    });
+    auto flag = CommitFlag();
+    flag.set_trigger(&trigger);
+    while(state.keep_running()) {
+      flag.clear();
+      flag.raise();
+    }
+    do_not_optimize(count);
+    state.set_items_processed(state.get_iterations());
+  }
+}
+
+ASPEN_BENCHMARK(trigger_signal);
+ASPEN_BENCHMARK(trigger_root_raise);
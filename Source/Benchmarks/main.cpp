@@ -0,0 +1,5 @@
+#include "Benchmarks.hpp"
+
+int main(int argc, char** argv) {
+  return Aspen::Benchmarks::run_benchmarks(argc, argv);
+}
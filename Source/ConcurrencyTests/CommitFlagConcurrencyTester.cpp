@@ -24,6 +24,8 @@ using namespace Aspen::Tests;
 
 namespace {
   constexpr auto HOLDERS = std::size_t(8);
+  constexpr auto HUB_PARENTS = std::size_t(1000);
+  constexpr auto HUB_RAISERS = std::size_t(4);
   constexpr auto PARENTS = std::size_t(16);
   constexpr auto PUSHES = 1000;
   constexpr auto RAISES = std::size_t(100000);
@@ -279,4 +281,41 @@ TEST_SUITE("CommitFlagConcurrency") {
       REQUIRE(values == expected);
     }
   }
+
+  TEST_CASE("hub_raise") {
+    auto hub = CommitFlag();
+    auto parents = std::deque<CommitFlag>(HUB_PARENTS);
+    for(auto& parent : parents) {
+      hub.add_parent(parent);
+    }
+    auto is_running = std::atomic_bool(true);
+    auto start = std::latch(HUB_RAISERS + 1);
+    auto raisers = std::vector<std::thread>();
+    for(auto i = std::size_t(0); i != HUB_RAISERS; ++i) {
+      raisers.emplace_back([&] {
+        start.arrive_and_wait();
+        while(is_running.load(std::memory_order_relaxed)) {
+          hub.raise();
+        }
+      });
+    }
+    start.arrive_and_wait();
+    auto iterations = get_iterations();
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      hub.clear();
+      for(auto& parent : parents) {
+        parent.clear();
+      }
+      std::this_thread::yield();
+    }
+    is_running.store(false, std::memory_order_relaxed);
+    for(auto& raiser : raisers) {
+      raiser.join();
+    }
+    hub.clear();
+    hub.raise();
+    for(auto& parent : parents) {
+      REQUIRE(parent.is_raised());
+    }
+  }
 }
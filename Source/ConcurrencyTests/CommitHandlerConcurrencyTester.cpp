@@ -0,0 +1,81 @@
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/CommitHandler.hpp"
+#include "Aspen/LockFreeQueue.hpp"
+#include "Aspen/Shared.hpp"
+#include "Aspen/SlotLayout.hpp"
+#include "Aspen/State.hpp"
+#include "ConcurrencyTests.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Tests;
+
+namespace {
+  constexpr auto CHILDREN = std::size_t(64);
+  constexpr auto PRODUCERS = std::size_t(8);
+  constexpr auto PUSHES = 100;
+
+  template<typename L>
+  void run(int pushes) {
+    auto queues = std::vector<Shared<LockFreeQueue<int>>>();
+    for(auto i = std::size_t(0); i != CHILDREN; ++i) {
+      queues.push_back(Shared(LockFreeQueue<int>()));
+    }
+    auto handler = CommitHandler<Shared<LockFreeQueue<int>>, L>(queues);
+    auto flag = CommitFlag();
+    auto sequence = std::uint64_t(0);
+    auto commit = [&] {
+      flag.clear();
+      auto scope = CommitFlagScope(flag);
+      return handler.commit(sequence++);
+    };
+    commit();
+    auto last = std::vector<int>(CHILDREN, -1);
+    auto producers = std::vector<std::thread>();
+    for(auto i = std::size_t(0); i != PRODUCERS; ++i) {
+      producers.emplace_back([&, i] {
+        for(auto j = 0; j != pushes; ++j) {
+          for(auto k = i; k < CHILDREN; k += PRODUCERS) {
+            queues[k]->push(j);
+          }
+        }
+      });
+    }
+    auto count = std::size_t(0);
+    auto is_ordered = true;
+    while(count != CHILDREN * pushes) {
+      commit();
+      for(auto index : handler.get_evaluated()) {
+        auto value = handler.get(index).eval();
+        is_ordered &= value == last[index] + 1;
+        last[index] = value;
+        ++count;
+      }
+    }
+    for(auto& producer : producers) {
+      producer.join();
+    }
+    REQUIRE(is_ordered);
+  }
+}
+
+TEST_SUITE("CommitHandlerConcurrency") {
+  TEST_CASE("packed_layout") {
+    auto iterations = get_iterations() / 100 + 1;
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      run<PackedSlotLayout>(PUSHES);
+    }
+  }
+
+  TEST_CASE("padded_layout") {
+    auto iterations = get_iterations() / 100 + 1;
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      run<PaddedSlotLayout<>>(PUSHES);
+      run<PaddedSlotLayout<4>>(PUSHES);
+    }
+  }
+}
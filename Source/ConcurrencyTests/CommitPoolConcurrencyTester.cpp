@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdint>
+#include <latch>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/Box.hpp"
+#include "Aspen/CommitHandler.hpp"
+#include "Aspen/CommitPool.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+#include "Aspen/State.hpp"
+#include "ConcurrencyTests.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Tests;
+
+namespace {
+  constexpr auto CHILDREN = 16;
+  constexpr auto VALUES = 50;
+  constexpr auto TIMEOUT = std::chrono::seconds(30);
+}
+
+TEST_SUITE("CommitPoolConcurrency") {
+  TEST_CASE("parallel_commit_handler") {
+    auto iterations = get_iterations() / 10 + 1;
+    auto pool = CommitPool(3);
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      auto queues = std::vector<Shared<Queue<int>>>();
+      auto children = std::vector<Box<int>>();
+      for(auto i = 0; i != CHILDREN; ++i) {
+        queues.push_back(Shared(Queue<int>()));
+        children.push_back(box(lift([] (int value) {
+          return 2 * value;
+        }, queues.back())));
+      }
+      auto reactor = CommitHandler(std::move(children), pool);
+      auto start = std::latch(2);
+      auto producer = std::thread([&] {
+        start.arrive_and_wait();
+        for(auto j = 1; j <= VALUES; ++j) {
+          for(auto& queue : queues) {
+            queue->push(j);
+          }
+        }
+        for(auto& queue : queues) {
+          queue->set_complete();
+        }
+      });
+      start.arrive_and_wait();
+      auto totals = std::vector<int>(CHILDREN, 0);
+      auto state = State::NONE;
+      auto sequence = std::uint64_t(0);
+      auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+      while(!is_complete(state) &&
+          std::chrono::steady_clock::now() < deadline) {
+        state = reactor.commit(sequence++);
+        auto previous = std::size_t(0);
+        for(auto i = std::size_t(0); i != reactor.get_evaluated().size();
+            ++i) {
+          auto index = reactor.get_evaluated()[i];
+          REQUIRE((i == 0 || previous < index));
+          previous = index;
+          totals[index] += reactor.get(index).eval();
+        }
+      }
+      producer.join();
+      REQUIRE(is_complete(state));
+      for(auto total : totals) {
+        REQUIRE(total == VALUES * (VALUES + 1));
+      }
+    }
+  }
+}
@@ -12,14 +12,19 @@
 #include "Aspen/Constant.hpp"
 #include "Aspen/Executor.hpp"
 #include "Aspen/Lift.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+#include "ConcurrencyTests.hpp"
 
 using namespace Aspen;
+using namespace Aspen::Tests;
 
 namespace {
   using SignalAction = struct ::sigaction;
 
   constexpr auto DURATION = std::chrono::seconds(10);
   constexpr auto INTERVAL = std::chrono::microseconds(50);
+  constexpr auto PUSHES = 100000;
   constexpr auto STALL = std::chrono::seconds(3);
 
   void ignore(int) {}
@@ -81,5 +86,30 @@ TEST_SUITE("ExecutorConcurrency") {
     REQUIRE(baseline);
     REQUIRE(commits.load(std::memory_order_relaxed) > *baseline);
   }
+
+  TEST_CASE("unpaused_pushes") {
+    auto iterations = get_iterations() / 1000 + 1;
+    auto strategies = {WaitStrategy::CONDITION_VARIABLE,
+      WaitStrategy::BUSY_SPIN, WaitStrategy::SPIN_YIELD,
+      WaitStrategy::SPIN_WAIT};
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      for(auto strategy : strategies) {
+        auto queue = Shared(Queue<int>());
+        auto count = std::atomic_int(0);
+        auto executor = Executor(lift([&] (int value) {
+          count.fetch_add(1, std::memory_order_relaxed);
+        }, queue), strategy);
+        auto runner = std::thread([&] {
+          executor.run_until_complete();
+        });
+        for(auto i = 0; i != PUSHES; ++i) {
+          queue->push(i);
+        }
+        queue->set_complete();
+        runner.join();
+        REQUIRE(count.load(std::memory_order_relaxed) == PUSHES);
+      }
+    }
+  }
 }
 #endif
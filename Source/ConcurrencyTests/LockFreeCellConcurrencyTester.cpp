@@ -0,0 +1,58 @@
+#include <cstdint>
+#include <thread>
+#include <doctest/doctest.h>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/LockFreeCell.hpp"
+#include "ConcurrencyTests.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Tests;
+
+namespace {
+  constexpr auto UPDATES = 10000;
+
+  struct Pair {
+    std::uint64_t m_first;
+    std::uint64_t m_second;
+  };
+}
+
+TEST_SUITE("LockFreeCellConcurrency") {
+  TEST_CASE("single_writer") {
+    auto iterations = get_iterations() / 100 + 1;
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      auto cell = LockFreeCell<Pair>();
+      auto flag = CommitFlag();
+      auto writer = std::thread([&] {
+        for(auto i = std::uint64_t(1); i != UPDATES; ++i) {
+          cell.set(Pair(i, ~i));
+        }
+        cell.set_complete(Pair(UPDATES, ~std::uint64_t(UPDATES)));
+      });
+      auto last = std::uint64_t(0);
+      auto is_consistent = true;
+      auto sequence = std::uint64_t(0);
+      while(true) {
+        if(!flag.is_raised()) {
+          std::this_thread::yield();
+          continue;
+        }
+        flag.clear();
+        auto scope = CommitFlagScope(flag);
+        auto state = cell.commit(sequence++);
+        if(has_evaluation(state)) {
+          auto value = cell.eval();
+          is_consistent &=
+            value.m_first > last && value.m_second == ~value.m_first;
+          last = value.m_first;
+        }
+        if(is_complete(state)) {
+          break;
+        }
+      }
+      writer.join();
+      REQUIRE(is_consistent);
+      REQUIRE(last == UPDATES);
+    }
+  }
+}
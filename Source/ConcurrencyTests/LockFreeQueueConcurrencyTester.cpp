@@ -0,0 +1,77 @@
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/LockFreeQueue.hpp"
+#include "Aspen/State.hpp"
+#include "ConcurrencyTests.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Tests;
+
+namespace {
+  constexpr auto PRODUCERS = std::size_t(4);
+  constexpr auto PUSHES = std::uint64_t(10000);
+
+  std::uint64_t consume(LockFreeQueue<std::uint64_t>& queue,
+      std::vector<std::uint64_t>& last) {
+    auto flag = CommitFlag();
+    auto count = std::uint64_t(0);
+    auto sequence = std::uint64_t(0);
+    while(true) {
+      flag.clear();
+      auto state = [&] {
+        auto scope = CommitFlagScope(flag);
+        return queue.commit(sequence);
+      }();
+      ++sequence;
+      if(has_evaluation(state)) {
+        ++count;
+        auto value = queue.eval();
+        auto producer = value / PUSHES;
+        auto index = value % PUSHES + 1;
+        REQUIRE(last[producer] < index);
+        last[producer] = index;
+      }
+      if(is_complete(state)) {
+        return count;
+      }
+    }
+  }
+
+  void run(std::vector<std::uint64_t>& last) {
+    auto queue = LockFreeQueue<std::uint64_t>();
+    auto producers = std::vector<std::thread>();
+    for(auto i = std::size_t(0); i != PRODUCERS; ++i) {
+      producers.emplace_back([&, i] {
+        for(auto j = std::uint64_t(0); j != PUSHES; ++j) {
+          queue.push(i * PUSHES + j);
+        }
+      });
+    }
+    auto completer = std::thread([&] {
+      for(auto& producer : producers) {
+        producer.join();
+      }
+      queue.set_complete();
+    });
+    auto count = consume(queue, last);
+    completer.join();
+    REQUIRE(count == PRODUCERS * PUSHES);
+  }
+}
+
+TEST_SUITE("LockFreeQueueConcurrency") {
+  TEST_CASE("multiple_producers") {
+    auto iterations = get_iterations() / 100 + 1;
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      auto last = std::vector<std::uint64_t>(PRODUCERS, 0);
+      run(last);
+      for(auto index : last) {
+        REQUIRE(index == PUSHES);
+      }
+    }
+  }
+}
@@ -0,0 +1,104 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/CommitPool.hpp"
+#include "Aspen/Executor.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Shared.hpp"
+#include "Aspen/Transaction.hpp"
+#include "Aspen/VectorSync.hpp"
+#include "ConcurrencyTests.hpp"
+
+using namespace Aspen;
+using namespace Aspen::Tests;
+
+namespace {
+  constexpr auto CELLS = 8;
+  constexpr auto DELAY = std::chrono::microseconds(100);
+  constexpr auto UPDATES = 100;
+}
+
+TEST_SUITE("TransactionConcurrency") {
+  TEST_CASE("glitch_free_commits") {
+    auto iterations = get_iterations() / 10 + 1;
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      auto cells = std::array<Shared<Cell<int>>, 4>();
+      for(auto& cell : cells) {
+        cell = Shared(Cell(0));
+      }
+      auto glitches = std::atomic_int(0);
+      auto executor = Executor(lift([&] (int a, int b, int c, int d) {
+        if(a != b || b != c || c != d) {
+          glitches.fetch_add(1, std::memory_order_relaxed);
+        }
+        return a;
+      }, cells[0], cells[1], cells[2], cells[3]));
+      auto producer = std::thread([&] {
+        for(auto i = 1; i <= UPDATES; ++i) {
+          auto transaction = Transaction();
+          for(auto& cell : cells) {
+            if(i == UPDATES) {
+              cell->set_complete(i);
+            } else {
+              cell->set(i);
+            }
+          }
+          transaction.commit();
+        }
+      });
+      executor.run_until_complete();
+      producer.join();
+      REQUIRE(glitches.load() == 0);
+    }
+  }
+  TEST_CASE("pooled_snapshot") {
+    auto iterations = get_iterations() / 100 + 1;
+    auto pool = CommitPool(3);
+    auto delay = [] (int value) {
+      std::this_thread::sleep_for(DELAY);
+      return value;
+    };
+    for(auto iteration = 0; iteration != iterations; ++iteration) {
+      auto cells = std::vector<Shared<Cell<int>>>();
+      auto reactors = std::vector<decltype(lift(delay, cells.front()))>();
+      for(auto i = 0; i != CELLS; ++i) {
+        cells.push_back(Shared(Cell(0)));
+        reactors.push_back(lift(delay, cells.back()));
+      }
+      auto values = std::vector<int>();
+      auto reactor = VectorSync(values, std::move(reactors), pool);
+      auto flag = CommitFlag();
+      auto sequence = std::uint64_t(0);
+      auto commit = [&] {
+        flag.clear();
+        auto scope = CommitFlagScope(flag);
+        return reactor.commit(sequence++);
+      };
+      {
+        auto snapshot = TransactionSnapshot();
+        REQUIRE(has_evaluation(commit()));
+      }
+      {
+        auto snapshot = TransactionSnapshot();
+        {
+          auto transaction = Transaction();
+          for(auto& cell : cells) {
+            cell->set(1);
+          }
+          transaction.commit();
+        }
+        commit();
+        REQUIRE(values == std::vector<int>(CELLS, 0));
+      }
+      auto snapshot = TransactionSnapshot();
+      REQUIRE(has_evaluation(commit()));
+      REQUIRE(values == std::vector<int>(CELLS, 1));
+    }
+  }
+}
@@ -4,6 +4,8 @@
 using namespace Aspen;
 using namespace pybind11;
 
+// Not declared with mod_gil_not_used() since commits and evaluations rely on
+// the GIL to serialize access to reactors shared across Python threads.
 PYBIND11_MODULE(aspen, m) {
   register_python_exception();
   export_box(m);
@@ -37,5 +39,6 @@ PYBIND11_MODULE(aspen, m) {
   export_trigger(m);
   export_unconsecutive(m);
   export_until(m);
+  export_vector_sync(m);
   export_when(m);
 }
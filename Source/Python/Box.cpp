@@ -1,4 +1,5 @@
 #include "Aspen/Python/Box.hpp"
+#include <cstdint>
 
 using namespace Aspen;
 using namespace pybind11;
@@ -6,5 +7,8 @@ using namespace pybind11;
 void Aspen::export_box(pybind11::module& module) {
   export_box<object>(module, "");
   export_box<void>(module, "None");
+  export_box<bool>(module, "Bool");
+  export_box<double>(module, "Float");
+  export_box<std::int64_t>(module, "Int");
   implicitly_convertible<SharedBox<object>, SharedBox<void>>();
 }
@@ -1,6 +1,8 @@
 #include "Aspen/Python/Executor.hpp"
 #include <atomic>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <utility>
 #include "Aspen/Executor.hpp"
 #include "Aspen/Shared.hpp"
@@ -10,17 +12,59 @@ using namespace Aspen;
 using namespace pybind11;
 
 namespace {
+  std::chrono::steady_clock::duration get_switch_interval() {
+    auto interval = module_::import("sys").attr("getswitchinterval")();
+    return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(interval.cast<double>()));
+  }
+
+  struct GilRun {
+    GilPolicy m_policy;
+    std::chrono::steady_clock::duration m_switch_interval;
+    std::optional<GilAcquireScope> m_lock;
+    std::chrono::steady_clock::time_point m_start;
+
+    explicit GilRun(GilPolicy policy)
+      : m_policy(policy),
+        m_switch_interval(get_switch_interval()) {}
+
+    void acquire() {
+      if(!m_lock) {
+        m_lock.emplace();
+        m_start = std::chrono::steady_clock::now();
+      }
+    }
+
+    void release(State state) {
+      if(m_policy == GilPolicy::COMMIT || !has_continuation(state) ||
+          is_complete(state) || std::chrono::steady_clock::now() - m_start >=
+            m_switch_interval) {
+        m_lock.reset();
+      }
+    }
+  };
+
   struct ExecutorReactor {
     using Type = void;
     SharedBox<void> m_reactor;
     std::shared_ptr<std::atomic_bool> m_is_complete;
+    std::shared_ptr<GilRun> m_run;
 
     ExecutorReactor(SharedBox<void> reactor,
-      std::shared_ptr<std::atomic_bool> is_complete)
+      std::shared_ptr<std::atomic_bool> is_complete,
+      std::shared_ptr<GilRun> run)
       : m_reactor(std::move(reactor)),
-        m_is_complete(std::move(is_complete)) {}
+        m_is_complete(std::move(is_complete)),
+        m_run(std::move(run)) {}
 
     State commit(std::uint64_t sequence) noexcept {
+      m_run->acquire();
+      auto state = commit_reactor(sequence);
+      m_run->release(state);
+      return state;
+    }
+
+    State commit_reactor(std::uint64_t sequence) noexcept {
       auto state = m_reactor.commit(sequence);
       if(has_evaluation(state)) {
         try {
@@ -41,6 +85,7 @@ namespace {
     }
 
     void eval() const {
+      auto lock = GilAcquireScope();
       m_reactor.eval();
     }
   };
@@ -48,19 +93,25 @@ namespace {
   class PythonExecutor {
     public:
       explicit PythonExecutor(SharedBox<void> reactor)
+        : PythonExecutor(std::move(reactor), GilPolicy::COMMIT) {}
+
+      PythonExecutor(SharedBox<void> reactor, GilPolicy policy)
         : m_is_complete(std::make_shared<std::atomic_bool>(false)),
           m_is_aborted(std::make_shared<std::atomic_bool>(false)),
-          m_executor(GilAcquireReactor(
-            ExecutorReactor(std::move(reactor), m_is_complete))) {}
+          m_run(std::make_shared<GilRun>(policy)),
+          m_executor(ExecutorReactor(std::move(reactor), m_is_complete,
+            m_run)) {}
 
       void run_until_none() {
         m_executor.run_until_none();
+        m_run->m_lock.reset();
       }
 
       void run_until_complete() {
         {
-          auto release = gil_scoped_release();
+          auto release = GilReleaseScope();
           m_executor.run_until_complete();
+          m_run->m_lock.reset();
         }
         if(!m_is_complete->load() && !m_is_aborted->load()) {
           PyErr_SetInterrupt();
@@ -72,20 +123,25 @@ namespace {
 
       void abort() {
         m_is_aborted->store(true);
-        auto release = gil_scoped_release();
+        auto release = GilReleaseScope();
         m_executor.abort();
       }
 
     private:
       std::shared_ptr<std::atomic_bool> m_is_complete;
       std::shared_ptr<std::atomic_bool> m_is_aborted;
+      std::shared_ptr<GilRun> m_run;
       Executor m_executor;
   };
 }
 
 void Aspen::export_executor(pybind11::module& module) {
+  enum_<GilPolicy>(module, "GilPolicy")
+    .value("COMMIT", GilPolicy::COMMIT)
+    .value("RUN", GilPolicy::RUN);
   class_<PythonExecutor>(module, "Executor")
     .def(init<SharedBox<void>>())
+    .def(init<SharedBox<void>, GilPolicy>())
     .def("run_until_none", &PythonExecutor::run_until_none)
     .def("run_until_complete", &PythonExecutor::run_until_complete)
     .def("abort", &PythonExecutor::abort);
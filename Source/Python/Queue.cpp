@@ -1,8 +1,11 @@
 #include "Aspen/Python/Queue.hpp"
+#include <cstdint>
 
 using namespace Aspen;
 using namespace pybind11;
 
 void Aspen::export_queue(pybind11::module& module) {
   export_queue<object>(module, "");
+  export_queue<double>(module, "Float");
+  export_queue<std::int64_t>(module, "Int");
 }
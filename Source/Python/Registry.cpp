@@ -1,10 +1,13 @@
 #include "Aspen/Python/Registry.hpp"
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 using namespace Aspen;
 using namespace pybind11;
 
 namespace {
+  std::shared_mutex box_registry_mutex;
   std::unordered_map<const _typeobject*, Boxers> box_registry;
 
   auto VALUE_BOXERS = [] {
@@ -16,13 +19,15 @@ void Aspen::register_reactor(const object& type,
     void (*boxer)(const object&, void*, const std::type_info&),
     SharedBox<object> (*object_boxer)(const object&),
     SharedBox<void> (*void_boxer)(const object&)) {
+  auto lock = std::lock_guard(box_registry_mutex);
   box_registry.insert(std::make_pair(
     reinterpret_cast<const _typeobject*>(type.ptr()),
     Boxers{boxer, object_boxer, void_boxer}));
 }
 
 const Boxers& Aspen::find_boxers(const object& value) {
-  auto i = box_registry.find(value.ptr()->ob_type);
+  auto lock = std::shared_lock(box_registry_mutex);
+  auto i = box_registry.find(Py_TYPE(value.ptr()));
   if(i == box_registry.end()) {
     return VALUE_BOXERS;
   }
@@ -3,6 +3,7 @@
 #include <utility>
 #include <pybind11/stl.h>
 #include "Aspen/Trigger.hpp"
+#include "Aspen/Python/GilAcquireReactor.hpp"
 
 using namespace Aspen;
 using namespace pybind11;
@@ -17,7 +18,7 @@ void Aspen::export_trigger(pybind11::module& module) {
     .def(init(
       [] (object slot) {
         return std::make_unique<Trigger>([slot = std::move(slot)] {
-          auto lock = gil_scoped_acquire();
+          auto lock = GilAcquireScope();
           try {
             slot();
           } catch(error_already_set& error) {
@@ -0,0 +1,63 @@
+#include "Aspen/Python/VectorSync.hpp"
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+#include "Aspen/VectorSync.hpp"
+#include "Aspen/Python/Box.hpp"
+
+using namespace Aspen;
+using namespace pybind11;
+
+namespace {
+  using Values = std::vector<double>;
+
+  object make_view(const std::shared_ptr<Values>& values) {
+    auto owner = capsule(new std::shared_ptr<Values>(values),
+      [] (void* owner) {
+        delete static_cast<std::shared_ptr<Values>*>(owner);
+      });
+    auto view = array_t<double>(values->size(), values->data(), owner);
+    view.attr("setflags")(arg("write") = false);
+    return view;
+  }
+
+  class ArrayVectorSync {
+    public:
+      using Type = object;
+
+      explicit ArrayVectorSync(std::vector<SharedBox<double>> reactors)
+        : ArrayVectorSync(std::make_shared<Values>(), std::move(reactors)) {}
+
+      State commit(std::uint64_t sequence) noexcept {
+        return m_sync.commit(sequence);
+      }
+
+      const object& eval() const {
+        m_sync.eval();
+        return m_view;
+      }
+
+    private:
+      std::shared_ptr<Values> m_values;
+      VectorSync<SharedBox<double>> m_sync;
+      object m_view;
+
+      ArrayVectorSync(std::shared_ptr<Values> values,
+        std::vector<SharedBox<double>> reactors)
+        : m_values(std::move(values)),
+          m_sync(*m_values, std::move(reactors)),
+          m_view(make_view(m_values)) {}
+  };
+}
+
+void Aspen::export_vector_sync(pybind11::module& module) {
+  export_reactor<ArrayVectorSync>(module, "VectorSync")
+    .def(init<std::vector<SharedBox<double>>>());
+  module.def("vector_sync",
+    [] (std::vector<SharedBox<double>> reactors) {
+      return ArrayVectorSync(std::move(reactors));
+    });
+}
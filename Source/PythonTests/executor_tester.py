@@ -47,6 +47,25 @@ class TestExecutor(unittest.TestCase):
     runner.join(timeout=10)
     self.assertFalse(runner.is_alive())
 
+  def test_run_policy(self):
+    commits = []
+    reactor = aspen.lift(lambda value: commits.append(value),
+      aspen.range(0, 100))
+    aspen.Executor(reactor, aspen.GilPolicy.RUN).run_until_complete()
+    self.assertEqual(commits, list(range(100)))
+
+  def test_aborting_a_run_policy(self):
+    started = threading.Event()
+    executor = aspen.Executor(
+      aspen.lift(lambda value: started.set(), aspen.range(0, 2 ** 62)),
+      aspen.GilPolicy.RUN)
+    runner = threading.Thread(target=executor.run_until_complete, daemon=True)
+    runner.start()
+    self.assertTrue(started.wait(timeout=10))
+    executor.abort()
+    runner.join(timeout=10)
+    self.assertFalse(runner.is_alive())
+
   @unittest.skipIf(sys.platform == 'win32', 'requires posix signals')
   def test_interrupting_a_run(self):
     started = threading.Event()
@@ -0,0 +1,40 @@
+import sys
+import sysconfig
+import threading
+import unittest
+
+from fixtures import aspen
+
+
+def run_executors(threads, sequences):
+  totals = [0] * threads
+
+  def run(index):
+    def accumulate(value):
+      totals[index] += value
+    executor = aspen.Executor(
+      aspen.lift(accumulate, aspen.range(0, sequences) * 2 + 1))
+    executor.run_until_complete()
+  runners = [threading.Thread(target=run, args=(index,))
+    for index in range(threads)]
+  for runner in runners:
+    runner.start()
+  for runner in runners:
+    runner.join()
+  return totals
+
+
+class TestFreeThreading(unittest.TestCase):
+  def test_parallel_executors(self):
+    threads = 4
+    totals = run_executors(threads, 1000)
+    self.assertEqual(totals, [1000 * 1000] * threads)
+
+  @unittest.skipUnless(sysconfig.get_config_var('Py_GIL_DISABLED'),
+    'requires a free-threaded build')
+  def test_gil_reenabled_on_import(self):
+    self.assertTrue(sys._is_gil_enabled())
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -0,0 +1,38 @@
+import time
+import unittest
+
+from fixtures import aspen
+
+NODES = 100
+SEQUENCES = 2000
+
+
+def build_graph():
+  reactor = aspen.range(0, SEQUENCES)
+  for node in range(NODES):
+    if node % 2 == 0:
+      reactor = aspen.lift(lambda value: value + 1, reactor)
+    else:
+      reactor = reactor - 1
+  return reactor
+
+
+def measure(policy):
+  executor = aspen.Executor(build_graph(), policy)
+  start = time.perf_counter()
+  executor.run_until_complete()
+  return time.perf_counter() - start
+
+
+class TestGilBenchmark(unittest.TestCase):
+  def test_interleaved_nodes(self):
+    commit = measure(aspen.GilPolicy.COMMIT)
+    run = measure(aspen.GilPolicy.RUN)
+    print('\nCOMMIT: {:.2f} us/sequence, RUN: {:.2f} us/sequence'.format(
+      1e6 * commit / SEQUENCES, 1e6 * run / SEQUENCES), flush=True)
+    self.assertGreater(commit, 0)
+    self.assertGreater(run, 0)
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -0,0 +1,71 @@
+import unittest
+
+from fixtures import aspen
+
+try:
+  import numpy
+except ImportError:
+  numpy = None
+
+
+@unittest.skipIf(numpy is None, 'requires numpy')
+class TestQueuePushMany(unittest.TestCase):
+  def test_float_queue(self):
+    queue = aspen.FloatQueue()
+    queue.push_many(numpy.arange(3, dtype=numpy.float64))
+    values = []
+    for sequence in range(3):
+      self.assertTrue(aspen.has_evaluation(queue.commit(sequence)))
+      values.append(queue.eval())
+    self.assertEqual(values, [0.0, 1.0, 2.0])
+
+  def test_converted_array(self):
+    queue = aspen.IntQueue()
+    queue.push_many(numpy.array([1, 2], dtype=numpy.int32))
+    self.assertTrue(aspen.has_evaluation(queue.commit(0)))
+    self.assertEqual(queue.eval(), 1)
+    with self.assertRaises(TypeError):
+      queue.push_many(numpy.array([1.5]))
+    self.assertTrue(aspen.has_evaluation(queue.commit(1)))
+    self.assertEqual(queue.eval(), 2)
+
+  def test_multidimensional_array(self):
+    queue = aspen.FloatQueue()
+    with self.assertRaises(ValueError):
+      queue.push_many(numpy.zeros((2, 2)))
+
+  def test_object_queue(self):
+    queue = aspen.Queue()
+    queue.push_many(['a', 'b'])
+    self.assertTrue(aspen.has_evaluation(queue.commit(0)))
+    self.assertEqual(queue.eval(), 'a')
+    self.assertTrue(aspen.has_evaluation(queue.commit(1)))
+    self.assertEqual(queue.eval(), 'b')
+
+
+@unittest.skipIf(numpy is None, 'requires numpy')
+class TestVectorSync(unittest.TestCase):
+  def test_view(self):
+    first = aspen.FloatBox(aspen.Cell(1.0))
+    second = aspen.FloatQueue()
+    second.push_many(numpy.array([2.0, 3.0]))
+    reactor = aspen.vector_sync([first, second])
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    view = reactor.eval()
+    self.assertIsInstance(view, numpy.ndarray)
+    self.assertEqual(view.tolist(), [1.0, 2.0])
+    self.assertFalse(view.flags.writeable)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(1)))
+    self.assertIs(reactor.eval(), view)
+    self.assertEqual(view.tolist(), [1.0, 3.0])
+
+  def test_view_outliving_the_reactor(self):
+    reactor = aspen.vector_sync([aspen.FloatBox(aspen.constant(4.0))])
+    reactor.commit(0)
+    view = reactor.eval()
+    del reactor
+    self.assertEqual(view.tolist(), [4.0])
+
+
+if __name__ == '__main__':
+  unittest.main()
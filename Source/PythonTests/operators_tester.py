@@ -28,5 +28,62 @@ class TestOperators(unittest.TestCase):
       reactor.eval()
 
 
+class TestTypedOperators(unittest.TestCase):
+  def test_float_arithmetic(self):
+    reactor = (aspen.FloatBox(aspen.constant(1.5)) * 2 + 0.25) / 4
+    self.assertIsInstance(reactor, aspen.FloatBox)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    self.assertEqual(reactor.eval(), 0.8125)
+
+  def test_integer_arithmetic(self):
+    reactor = aspen.IntBox(aspen.constant(7)) * 3 - aspen.BoolBox(True)
+    self.assertIsInstance(reactor, aspen.IntBox)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    self.assertEqual(reactor.eval(), 20)
+
+  def test_mixed_arithmetic(self):
+    reactor = aspen.IntBox(aspen.constant(3)) + aspen.FloatBox(
+      aspen.constant(0.5))
+    self.assertIsInstance(reactor, aspen.FloatBox)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    self.assertEqual(reactor.eval(), 3.5)
+
+  def test_comparison(self):
+    reactor = aspen.FloatBox(aspen.constant(2.5)) > 2
+    self.assertIsInstance(reactor, aspen.BoolBox)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    self.assertTrue(reactor.eval())
+
+  def test_integer_true_division(self):
+    reactor = aspen.IntBox(aspen.constant(7)) / 2
+    self.assertNotIsInstance(reactor, aspen.FloatBox)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    self.assertEqual(reactor.eval(), 3.5)
+
+  def test_division_by_zero(self):
+    reactor = aspen.FloatBox(aspen.constant(1.0)) / 0.0
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    with self.assertRaises(ZeroDivisionError):
+      reactor.eval()
+
+  def test_integer_overflow(self):
+    reactor = aspen.IntBox(aspen.constant(2 ** 62)) * 2
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    with self.assertRaises(OverflowError):
+      reactor.eval()
+
+  def test_large_integer_operand(self):
+    reactor = aspen.IntBox(aspen.constant(1)) + 2 ** 70
+    self.assertNotIsInstance(reactor, aspen.IntBox)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    self.assertEqual(reactor.eval(), 2 ** 70 + 1)
+
+  def test_object_operands(self):
+    reactor = aspen.FloatBox(aspen.constant(1.5)) + aspen.constant(1)
+    self.assertNotIsInstance(reactor, aspen.FloatBox)
+    self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
+    self.assertEqual(reactor.eval(), 2.5)
+
+
 if __name__ == '__main__':
   unittest.main()
@@ -0,0 +1,49 @@
+import time
+import unittest
+
+from fixtures import aspen
+
+REACTORS = 100
+SEQUENCES = 2000
+
+
+class Ticking:
+  def commit(self, sequence):
+    return aspen.State.CONTINUE_EVALUATED
+
+  def eval(self):
+    return 1.0
+
+
+def measure_direct(reactors):
+  start = time.perf_counter()
+  for sequence in range(SEQUENCES):
+    for reactor in reactors:
+      reactor.commit(sequence)
+      reactor.eval()
+  return time.perf_counter() - start
+
+
+def measure_boxed(reactors):
+  reactor = aspen.lift(lambda *values: None, *reactors)
+  start = time.perf_counter()
+  for sequence in range(SEQUENCES):
+    reactor.commit(sequence)
+    reactor.eval()
+  return time.perf_counter() - start
+
+
+class TestPythonBoxBenchmark(unittest.TestCase):
+  def test_commit_overhead(self):
+    reactors = [Ticking() for _ in range(REACTORS)]
+    direct = measure_direct(reactors)
+    boxed = measure_boxed(reactors)
+    commits = REACTORS * SEQUENCES
+    print('\nPython: {:.1f} ns/commit, Boxed: {:.1f} ns/commit, '
+      'Overhead: {:.1f} ns/commit'.format(1e9 * direct / commits,
+        1e9 * boxed / commits, 1e9 * (boxed - direct) / commits), flush=True)
+    self.assertGreater(boxed, 0)
+
+
+if __name__ == '__main__':
+  unittest.main()
@@ -31,12 +31,35 @@ class Counting:
     return self.commits
 
 
+class Evaluating:
+  def __init__(self):
+    self.evaluations = 0
+
+  def commit(self, sequence):
+    return aspen.State.EVALUATED
+
+  def eval(self):
+    self.evaluations += 1
+    return self.evaluations
+
+
 class TestPythonReactor(unittest.TestCase):
   def test_commit(self):
     reactor = aspen.Box(Counting())
     self.assertEqual(reactor.commit(0), aspen.State.COMPLETE_EVALUATED)
     self.assertEqual(reactor.eval(), 1)
 
+  def test_cached_evaluation(self):
+    python_reactor = Evaluating()
+    reactor = aspen.Box(python_reactor)
+    self.assertEqual(reactor.commit(0), aspen.State.EVALUATED)
+    self.assertEqual(reactor.eval(), 1)
+    self.assertEqual(reactor.eval(), 1)
+    self.assertEqual(python_reactor.evaluations, 1)
+    self.assertEqual(reactor.commit(1), aspen.State.EVALUATED)
+    self.assertEqual(reactor.eval(), 2)
+    self.assertEqual(python_reactor.evaluations, 2)
+
   def test_raising_commit(self):
     reactor = aspen.Box(Failing())
     self.assertTrue(aspen.has_evaluation(reactor.commit(0)))
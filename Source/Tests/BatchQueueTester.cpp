@@ -0,0 +1,142 @@
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/BatchQueue.hpp"
+#include "Aspen/Shared.hpp"
+
+using namespace Aspen;
+
+namespace {
+  template<typename T>
+  std::vector<T> to_vector(std::span<const T> batch) {
+    return std::vector<T>(batch.begin(), batch.end());
+  }
+}
+
+TEST_SUITE("BatchQueue") {
+  TEST_CASE("immediate_completion") {
+    auto queue = BatchQueue<int>();
+    queue.set_complete();
+    REQUIRE(queue.commit(0) == State::COMPLETE);
+  }
+
+  TEST_CASE("immediate_exception") {
+    auto queue = BatchQueue<int>();
+    queue.set_complete(std::runtime_error(""));
+    REQUIRE(queue.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("uninitialized") {
+    auto queue = BatchQueue<int>();
+    REQUIRE(queue.commit(0) == State::NONE);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("value") {
+    auto queue = BatchQueue<int>();
+    queue.set_complete(123);
+    REQUIRE(queue.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(to_vector(queue.eval()) == std::vector{123});
+  }
+
+  TEST_CASE("several_values") {
+    auto queue = BatchQueue<int>();
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+    REQUIRE(queue.commit(0) == State::EVALUATED);
+    REQUIRE(to_vector(queue.eval()) == std::vector{1, 2, 3});
+    REQUIRE(queue.commit(1) == State::NONE);
+    REQUIRE(to_vector(queue.eval()) == std::vector{1, 2, 3});
+    queue.push(4);
+    queue.push(5);
+    REQUIRE(queue.commit(2) == State::EVALUATED);
+    REQUIRE(to_vector(queue.eval()) == std::vector{4, 5});
+  }
+
+  TEST_CASE("values_then_completion") {
+    auto queue = BatchQueue<int>();
+    queue.push(1);
+    queue.set_complete(2);
+    queue.push(3);
+    REQUIRE(queue.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(to_vector(queue.eval()) == std::vector{1, 2});
+  }
+
+  TEST_CASE("values_then_an_exception") {
+    auto queue = BatchQueue<int>();
+    queue.push(1);
+    queue.push(2);
+    queue.set_complete(std::runtime_error(""));
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(to_vector(queue.eval()) == std::vector{1, 2});
+    REQUIRE(queue.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("raises_once_per_batch") {
+    auto queue = BatchQueue<int>();
+    auto flag = CommitFlag();
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(0) == State::NONE);
+    }
+    queue.push(1);
+    REQUIRE(flag.is_raised());
+    flag.clear();
+    queue.push(2);
+    REQUIRE(!flag.is_raised());
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(1) == State::EVALUATED);
+    }
+    queue.push(3);
+    REQUIRE(flag.is_raised());
+  }
+
+  TEST_CASE("move_construction") {
+    auto queue = BatchQueue<int>();
+    queue.push(1);
+    REQUIRE(queue.commit(0) == State::EVALUATED);
+    queue.push(2);
+    auto moved = BatchQueue<int>(std::move(queue));
+    REQUIRE(to_vector(moved.eval()) == std::vector{1});
+    REQUIRE(moved.commit(1) == State::EVALUATED);
+    REQUIRE(to_vector(moved.eval()) == std::vector{2});
+  }
+
+  TEST_CASE("fold_batch") {
+    auto queue = Shared(BatchQueue<int>());
+    auto sum = fold_batch([] (int total, int value) {
+      return total + value;
+    }, 0, queue);
+    queue->push(1);
+    queue->push(2);
+    queue->push(3);
+    REQUIRE(sum.commit(0) == State::EVALUATED);
+    REQUIRE(sum.eval() == 6);
+    REQUIRE(sum.commit(1) == State::NONE);
+    queue->push(4);
+    queue->set_complete();
+    REQUIRE(sum.commit(2) == State::COMPLETE_EVALUATED);
+    REQUIRE(sum.eval() == 10);
+  }
+
+  TEST_CASE("for_each_batch") {
+    auto queue = Shared(BatchQueue<int>());
+    auto values = std::vector<int>();
+    auto reactor = for_each_batch([&] (int value) {
+      values.push_back(value);
+    }, queue);
+    queue->push(1);
+    queue->push(2);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE(values == std::vector{1, 2});
+    queue->set_complete(3);
+    REQUIRE(reactor.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE(values == std::vector{1, 2, 3});
+  }
+}
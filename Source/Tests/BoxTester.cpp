@@ -1,3 +1,4 @@
+#include <array>
 #include <cstdint>
 #include <stdexcept>
 #include <type_traits>
@@ -5,6 +6,7 @@
 #include <doctest/doctest.h>
 #include "Aspen/Box.hpp"
 #include "Aspen/Constant.hpp"
+#include "Aspen/Lift.hpp"
 
 using namespace Aspen;
 
@@ -33,6 +35,22 @@ namespace {
     }
   };
 
+  struct Unmovable {
+    using Type = int;
+
+    Unmovable() = default;
+    Unmovable(Unmovable&&) noexcept(false) {}
+
+    State commit(std::uint64_t sequence) noexcept {
+      return State::COMPLETE_EVALUATED;
+    }
+
+    const int& eval() const noexcept {
+      static const auto value = 321;
+      return value;
+    }
+  };
+
   struct Checked {
     int m_value;
 
@@ -112,4 +130,40 @@ TEST_SUITE("Box") {
     REQUIRE(outer.commit(0) == State::COMPLETE_EVALUATED);
     REQUIRE(outer.eval() == 123);
   }
+
+  TEST_CASE("inline_storage") {
+    auto small = box(Constant(123));
+    REQUIRE(small.is_inline());
+    auto large = box(lift([padding = std::array<char, Box<int>::BUFFER_SIZE>()]
+        (int value) {
+      return value + padding[0] + 1;
+    }, constant(1)));
+    REQUIRE(!large.is_inline());
+    auto throwing = box(Unmovable());
+    REQUIRE(!throwing.is_inline());
+    REQUIRE(throwing.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(throwing.eval() == 321);
+  }
+
+  TEST_CASE("move") {
+    auto small = box(Constant(123));
+    auto large = box(lift([padding = std::array<char, Box<int>::BUFFER_SIZE>()]
+        (int value) {
+      return value + padding[0] + 1;
+    }, constant(1)));
+    auto moved_small = std::move(small);
+    REQUIRE(!small.is_inline());
+    REQUIRE(moved_small.is_inline());
+    REQUIRE(moved_small.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(moved_small.eval() == 123);
+    auto moved_large = std::move(large);
+    REQUIRE(moved_large.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(moved_large.eval() == 2);
+    moved_large = std::move(moved_small);
+    REQUIRE(moved_large.is_inline());
+    REQUIRE(moved_large.eval() == 123);
+    moved_small = box(Constant(5));
+    REQUIRE(moved_small.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(moved_small.eval() == 5);
+  }
 }
@@ -256,6 +256,21 @@ TEST_SUITE("CommitFlag") {
     REQUIRE(word.load() == std::uint64_t(1) << 3);
   }
 
+  TEST_CASE("slot_with_a_summary") {
+    auto word = std::atomic_uint64_t(0);
+    auto summary = std::atomic_uint64_t(0);
+    auto flag = CommitFlag();
+    flag.set_slot(&word, 3, &summary, 9);
+    REQUIRE(word.load() == std::uint64_t(1) << 3);
+    REQUIRE(summary.load() == std::uint64_t(1) << 9);
+    flag.clear();
+    word.store(0);
+    summary.store(0);
+    flag.raise();
+    REQUIRE(word.load() == std::uint64_t(1) << 3);
+    REQUIRE(summary.load() == std::uint64_t(1) << 9);
+  }
+
   TEST_CASE("assigning_a_slot") {
     auto flag = CommitFlag();
     REQUIRE(!flag.has_slot());
@@ -1,13 +1,16 @@
+#include <cstddef>
 #include <utility>
 #include <vector>
 #include <doctest/doctest.h>
 #include "Aspen/Box.hpp"
 #include "Aspen/Chain.hpp"
 #include "Aspen/CommitHandler.hpp"
+#include "Aspen/CommitPool.hpp"
 #include "Aspen/Constant.hpp"
 #include "Aspen/Last.hpp"
 #include "Aspen/Queue.hpp"
 #include "Aspen/Shared.hpp"
+#include "Aspen/SlotLayout.hpp"
 #include "Aspen/Tests/ReactorTests.hpp"
 
 using namespace Aspen;
@@ -99,6 +102,54 @@ TEST_SUITE("CommitHandler") {
     REQUIRE(reactor.get(70).eval() == 7);
   }
 
+  TEST_CASE("more_children_than_a_summary_word") {
+    auto queues = std::vector<Shared<Queue<int>>>();
+    auto children = std::vector<Box<int>>();
+    for(auto i = 0; i != 5000; ++i) {
+      queues.push_back(Shared(Queue<int>()));
+      children.push_back(box(queues.back()));
+    }
+    auto reactor = CommitHandler(std::move(children));
+    REQUIRE(reactor.commit(0) == State::NONE);
+    for(auto i = 0; i != 5000; ++i) {
+      queues[i]->push(i);
+    }
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.get_evaluated().size() == 5000);
+    queues[4500]->push(45);
+    queues[63]->push(6);
+    queues[4096]->push(40);
+    REQUIRE(reactor.commit(2) == State::EVALUATED);
+    REQUIRE(reactor.get_evaluated() ==
+      std::vector<std::size_t>{63, 4096, 4500});
+    REQUIRE(reactor.get(4096).eval() == 40);
+    REQUIRE(reactor.commit(3) == State::NONE);
+    REQUIRE(reactor.get_evaluated().empty());
+  }
+
+  TEST_CASE("padded_layout") {
+    static_assert(sizeof(PaddedSlotLayout<>::Word) == CACHE_LINE_SIZE);
+    auto queues = std::vector<Shared<Queue<int>>>();
+    auto children = std::vector<Box<int>>();
+    for(auto i = 0; i != 10; ++i) {
+      queues.push_back(Shared(Queue<int>()));
+      children.push_back(box(queues.back()));
+    }
+    auto reactor =
+      CommitHandler<Box<int>, PaddedSlotLayout<4>>(std::move(children));
+    REQUIRE(reactor.commit(0) == State::NONE);
+    for(auto i = 0; i != 10; ++i) {
+      queues[i]->push(i);
+    }
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.get_evaluated().size() == 10);
+    queues[9]->push(9);
+    queues[5]->push(5);
+    REQUIRE(reactor.commit(2) == State::EVALUATED);
+    REQUIRE(reactor.get_evaluated() == std::vector<std::size_t>{5, 9});
+    REQUIRE(reactor.commit(3) == State::NONE);
+  }
+
   TEST_CASE("move_construction") {
     auto queue = Shared(Queue<int>());
     auto reactor = CommitHandler(std::vector{queue});
@@ -153,4 +204,38 @@ TEST_SUITE("CommitHandler") {
     REQUIRE(reactor.commit(2) == State::EVALUATED);
     REQUIRE(first.get_commits() == 1);
   }
+
+  TEST_CASE("parallel_commit") {
+    auto pool = CommitPool(3);
+    auto queues = std::vector<Shared<Queue<int>>>();
+    auto children = std::vector<Box<int>>();
+    for(auto i = 0; i != 200; ++i) {
+      queues.push_back(Shared(Queue<int>()));
+      children.push_back(box(queues.back()));
+    }
+    auto reactor = CommitHandler(std::move(children), pool);
+    REQUIRE(reactor.commit(0) == State::NONE);
+    for(auto i = 0; i != 200; ++i) {
+      queues[i]->push(i);
+    }
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.get_evaluated().size() == 200);
+    for(auto i = 0; i != 200; ++i) {
+      REQUIRE(reactor.get_evaluated()[i] == static_cast<std::size_t>(i));
+      REQUIRE(reactor.get(i).eval() == i);
+    }
+    queues[150]->push(1);
+    queues[3]->push(2);
+    queues[3]->push(3);
+    queues[64]->push(4);
+    REQUIRE(reactor.commit(2) == State::CONTINUE_EVALUATED);
+    REQUIRE(reactor.get_evaluated() == std::vector<std::size_t>{3, 64, 150});
+    REQUIRE(reactor.commit(3) == State::EVALUATED);
+    REQUIRE(reactor.get_evaluated() == std::vector<std::size_t>{3});
+    REQUIRE(reactor.get(3).eval() == 3);
+    for(auto& queue : queues) {
+      queue->set_complete();
+    }
+    REQUIRE(reactor.commit(4) == State::COMPLETE);
+  }
 }
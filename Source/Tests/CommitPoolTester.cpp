@@ -0,0 +1,55 @@
+#include <atomic>
+#include <cstddef>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/CommitPool.hpp"
+
+using namespace Aspen;
+
+TEST_SUITE("CommitPool") {
+  TEST_CASE("run") {
+    auto pool = CommitPool(3);
+    REQUIRE(pool.get_thread_count() == 3);
+    for(auto count : {0, 1, 2, 100}) {
+      auto calls = std::vector<std::atomic_int>(count);
+      pool.run(count, [&] (std::size_t index) noexcept {
+        ++calls[index];
+      });
+      for(auto& call : calls) {
+        REQUIRE(call.load() == 1);
+      }
+    }
+  }
+
+  TEST_CASE("fewer_tasks_than_workers") {
+    auto pool = CommitPool(8);
+    for(auto i = 0; i != 100; ++i) {
+      auto calls = std::vector<std::atomic_int>(2);
+      pool.run(2, [&] (std::size_t index) noexcept {
+        ++calls[index];
+      });
+      REQUIRE(calls[0].load() == 1);
+      REQUIRE(calls[1].load() == 1);
+    }
+  }
+
+  TEST_CASE("no_workers") {
+    auto pool = CommitPool(0);
+    auto indices = std::vector<std::size_t>();
+    pool.run(3, [&] (std::size_t index) noexcept {
+      indices.push_back(index);
+    });
+    REQUIRE(indices == std::vector<std::size_t>{0, 1, 2});
+  }
+
+  TEST_CASE("nested_run") {
+    auto pool = CommitPool(2);
+    auto total = std::atomic_int(0);
+    pool.run(4, [&] (std::size_t) noexcept {
+      pool.run(4, [&] (std::size_t) noexcept {
+        ++total;
+      });
+    });
+    REQUIRE(total.load() == 16);
+  }
+}
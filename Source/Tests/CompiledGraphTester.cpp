@@ -0,0 +1,187 @@
+#include <stdexcept>
+#include <doctest/doctest.h>
+#include "Aspen/CompiledGraph.hpp"
+#include "Aspen/Constant.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+
+using namespace Aspen;
+
+namespace {
+  int square(int x) {
+    return x * x;
+  }
+}
+
+TEST_SUITE("CompiledGraph") {
+  TEST_CASE("constant_source") {
+    auto builder = GraphBuilder();
+    auto source = builder.source(5);
+    auto output = builder.lift(square, source);
+    REQUIRE(source.get_index() == 0);
+    REQUIRE(output.get_index() == 1);
+    auto reactor = builder.compile(output);
+    REQUIRE(reactor.get_size() == 2);
+    REQUIRE(reactor.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(reactor.eval() == 25);
+  }
+
+  TEST_CASE("one_argument") {
+    auto queue = Shared(Queue<int>());
+    auto builder = GraphBuilder();
+    auto reactor = builder.compile(builder.lift(square, builder.source(queue)));
+    REQUIRE(reactor.commit(0) == State::NONE);
+    queue->push(10);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 100);
+    REQUIRE(reactor.commit(2) == State::NONE);
+    queue->push(5);
+    REQUIRE(reactor.commit(3) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 25);
+    REQUIRE(reactor.commit(4) == State::NONE);
+    queue->set_complete(4);
+    REQUIRE(reactor.commit(5) == State::COMPLETE_EVALUATED);
+    REQUIRE(reactor.eval() == 16);
+  }
+
+  TEST_CASE("several_arguments") {
+    auto left = Shared(Queue<int>());
+    auto right = Shared(Queue<int>());
+    auto builder = GraphBuilder();
+    auto reactor = builder.compile(builder.lift([] (int a, int b) {
+      return a * b;
+    }, builder.source(left), builder.source(right)));
+    left->push(3);
+    REQUIRE(reactor.commit(0) == State::NONE);
+    right->push(4);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 12);
+    left->push(5);
+    REQUIRE(reactor.commit(2) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 20);
+    left->set_complete();
+    REQUIRE(reactor.commit(3) == State::NONE);
+    right->set_complete();
+    REQUIRE(reactor.commit(4) == State::COMPLETE);
+    REQUIRE(reactor.eval() == 20);
+  }
+
+  TEST_CASE("argument_completes_without_value") {
+    auto left = Shared(Queue<int>());
+    auto right = Shared(Queue<int>());
+    auto builder = GraphBuilder();
+    auto reactor = builder.compile(builder.lift([] (int a, int b) {
+      return a * b;
+    }, builder.source(left), builder.source(right)));
+    right->push(4);
+    REQUIRE(reactor.commit(0) == State::NONE);
+    left->set_complete();
+    REQUIRE(reactor.commit(1) == State::COMPLETE);
+  }
+
+  TEST_CASE("continuing_source") {
+    auto queue = Shared(Queue<int>());
+    auto builder = GraphBuilder();
+    auto reactor = builder.compile(builder.lift(square, builder.source(queue)));
+    queue->push(2);
+    queue->push(3);
+    REQUIRE(reactor.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(reactor.eval() == 4);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 9);
+  }
+
+  TEST_CASE("diamond") {
+    auto queue = Shared(Queue<int>());
+    auto calls = 0;
+    auto builder = GraphBuilder();
+    auto source = builder.source(queue);
+    auto left = builder.lift([] (int x) {
+      return x + 1;
+    }, source);
+    auto right = builder.lift([] (int x) {
+      return x * 2;
+    }, source);
+    auto reactor = builder.compile(builder.lift([&] (int a, int b) {
+      ++calls;
+      return a + b;
+    }, left, right));
+    queue->push(10);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 31);
+    REQUIRE(calls == 1);
+    queue->push(1);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 4);
+    REQUIRE(calls == 2);
+  }
+
+  TEST_CASE("untouched_branch") {
+    auto left = Shared(Queue<int>());
+    auto right = Shared(Queue<int>());
+    auto calls = 0;
+    auto builder = GraphBuilder();
+    auto counted = builder.lift([&] (int x) {
+      ++calls;
+      return x;
+    }, builder.source(right));
+    auto reactor = builder.compile(builder.lift([] (int a, int b) {
+      return a - b;
+    }, builder.source(left), counted));
+    left->push(10);
+    right->push(3);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 7);
+    REQUIRE(calls == 1);
+    left->push(20);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 17);
+    REQUIRE(calls == 1);
+  }
+
+  TEST_CASE("deep_chain") {
+    auto queue = Shared(Queue<int>());
+    auto builder = GraphBuilder();
+    auto node = builder.source(queue);
+    for(auto i = 0; i != 100; ++i) {
+      node = builder.lift([] (int x) {
+        return x + 1;
+      }, node);
+    }
+    auto reactor = builder.compile(node);
+    REQUIRE(reactor.get_size() == 101);
+    queue->push(0);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 100);
+    queue->push(5);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 105);
+  }
+
+  TEST_CASE("argument_exception") {
+    auto queue = Shared(Queue<int>());
+    auto builder = GraphBuilder();
+    auto reactor = builder.compile(builder.lift(square, builder.source(queue)));
+    queue->set_complete(std::runtime_error("fail"));
+    REQUIRE(reactor.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(reactor.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("function_exception") {
+    auto queue = Shared(Queue<int>());
+    auto builder = GraphBuilder();
+    auto failing = builder.lift([] (int x) {
+      if(x < 0) {
+        throw std::runtime_error("fail");
+      }
+      return x;
+    }, builder.source(queue));
+    auto reactor = builder.compile(builder.lift(square, failing));
+    queue->push(-1);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE_THROWS_AS(reactor.eval(), std::runtime_error);
+    queue->push(3);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 9);
+  }
+}
@@ -226,6 +226,47 @@ TEST_SUITE("Concur") {
     REQUIRE(reactor.eval() == 3);
   }
 
+  TEST_CASE("more_children_than_a_summary_word") {
+    auto producer = Producer();
+    auto queues = std::vector<Shared<Queue<int>>>();
+    for(auto i = 0; i != 5000; ++i) {
+      queues.push_back(Shared(Queue<int>()));
+      producer->push(shared_box(queues.back()));
+    }
+    producer->set_complete();
+    auto reactor = concur(producer);
+    auto sequence = std::uint64_t(0);
+    absorb(reactor, sequence, 5005);
+    queues[4500]->push(45);
+    REQUIRE(reactor.commit(sequence++) == State::CONTINUE_EVALUATED);
+    REQUIRE(reactor.eval() == 45);
+    queues[10]->push(1);
+    queues[4200]->push(42);
+    REQUIRE(reactor.commit(sequence++) == State::CONTINUE_EVALUATED);
+    REQUIRE(reactor.eval() == 1);
+    REQUIRE(reactor.commit(sequence++) == State::CONTINUE_EVALUATED);
+    REQUIRE(reactor.eval() == 42);
+  }
+
+  TEST_CASE("padded_layout") {
+    auto producer = Producer();
+    auto queues = std::vector<Shared<Queue<int>>>();
+    for(auto i = 0; i != 10; ++i) {
+      queues.push_back(Shared(Queue<int>()));
+      producer->push(shared_box(queues.back()));
+    }
+    producer->set_complete();
+    auto reactor = Concur<Producer, PaddedSlotLayout<>>(producer);
+    auto sequence = std::uint64_t(0);
+    absorb(reactor, sequence, 15);
+    queues[7]->push(7);
+    queues[2]->push(2);
+    REQUIRE(reactor.commit(sequence++) == State::CONTINUE_EVALUATED);
+    REQUIRE(reactor.eval() == 2);
+    REQUIRE(reactor.commit(sequence++) == State::CONTINUE_EVALUATED);
+    REQUIRE(reactor.eval() == 7);
+  }
+
   TEST_CASE("reusing_a_slot") {
     auto producer = Producer();
     auto first = Shared(Queue<int>());
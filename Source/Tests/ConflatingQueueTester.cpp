@@ -0,0 +1,125 @@
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <doctest/doctest.h>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/ConflatingQueue.hpp"
+
+using namespace Aspen;
+using namespace std::string_literals;
+
+TEST_SUITE("ConflatingQueue") {
+  TEST_CASE("immediate_completion") {
+    auto queue = ConflatingQueue<std::string, int>();
+    queue.set_complete();
+    REQUIRE(queue.commit(0) == State::COMPLETE);
+  }
+
+  TEST_CASE("immediate_exception") {
+    auto queue = ConflatingQueue<std::string, int>();
+    queue.set_complete(std::runtime_error(""));
+    REQUIRE(queue.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("first_arrival_order") {
+    auto queue = ConflatingQueue<std::string, int>();
+    REQUIRE(queue.commit(0) == State::NONE);
+    queue.push("A", 1);
+    queue.push("B", 2);
+    queue.push("A", 3);
+    queue.push("C", 4);
+    queue.push("B", 5);
+    REQUIRE(queue.get_conflation_count() == 2);
+    REQUIRE(queue.commit(1) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair("A"s, 3));
+    REQUIRE(queue.commit(2) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair("B"s, 5));
+    REQUIRE(queue.commit(3) == State::EVALUATED);
+    REQUIRE(queue.eval() == std::pair("C"s, 4));
+    REQUIRE(queue.commit(4) == State::NONE);
+    REQUIRE(queue.eval() == std::pair("C"s, 4));
+  }
+
+  TEST_CASE("pushing_a_delivered_key") {
+    auto queue = ConflatingQueue<std::string, int>();
+    queue.push("A", 1);
+    queue.push("B", 2);
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair("A"s, 1));
+    queue.push("A", 3);
+    REQUIRE(queue.commit(1) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair("B"s, 2));
+    REQUIRE(queue.commit(2) == State::EVALUATED);
+    REQUIRE(queue.eval() == std::pair("A"s, 3));
+  }
+
+  TEST_CASE("dropping_the_oldest") {
+    auto queue = ConflatingQueue<int, int>(2, OverflowPolicy::DROP_OLDEST);
+    queue.push(1, 10);
+    queue.push(2, 20);
+    queue.push(2, 21);
+    queue.push(3, 30);
+    REQUIRE(queue.get_drop_count() == 1);
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair(2, 21));
+    REQUIRE(queue.commit(1) == State::EVALUATED);
+    REQUIRE(queue.eval() == std::pair(3, 30));
+    queue.push(1, 11);
+    REQUIRE(queue.commit(2) == State::EVALUATED);
+    REQUIRE(queue.eval() == std::pair(1, 11));
+  }
+
+  TEST_CASE("dropping_the_newest") {
+    auto queue = ConflatingQueue<int, int>(2, OverflowPolicy::DROP_NEWEST);
+    queue.push(1, 10);
+    queue.push(2, 20);
+    queue.push(3, 30);
+    queue.push(1, 11);
+    REQUIRE(queue.get_drop_count() == 1);
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair(1, 11));
+    REQUIRE(queue.commit(1) == State::EVALUATED);
+    REQUIRE(queue.eval() == std::pair(2, 20));
+  }
+
+  TEST_CASE("completion_after_values") {
+    auto queue = ConflatingQueue<int, int>();
+    queue.push(1, 10);
+    queue.push(2, 20);
+    queue.set_complete();
+    queue.push(3, 30);
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair(1, 10));
+    REQUIRE(queue.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair(2, 20));
+  }
+
+  TEST_CASE("exception_after_values") {
+    auto queue = ConflatingQueue<int, int>();
+    queue.push(1, 10);
+    queue.set_complete(std::runtime_error(""));
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == std::pair(1, 10));
+    REQUIRE(queue.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+    REQUIRE(queue.commit(2) == State::COMPLETE);
+  }
+
+  TEST_CASE("raising_on_a_new_key") {
+    auto flag = CommitFlag();
+    auto queue = ConflatingQueue<int, int>();
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(0) == State::NONE);
+    }
+    flag.clear();
+    queue.push(1, 10);
+    REQUIRE(flag.is_raised());
+    flag.clear();
+    queue.push(1, 11);
+    REQUIRE(!flag.is_raised());
+    queue.push(2, 20);
+    REQUIRE(flag.is_raised());
+  }
+}
@@ -1,4 +1,5 @@
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <csignal>
 #include <cstdint>
@@ -392,4 +393,86 @@ TEST_SUITE("Executor") {
     REQUIRE(first_values == std::vector{1});
     REQUIRE(second_values == std::vector{2});
   }
+
+  TEST_CASE("wait_strategies") {
+    for(auto strategy : {WaitStrategy::CONDITION_VARIABLE,
+        WaitStrategy::BUSY_SPIN, WaitStrategy::SPIN_YIELD,
+        WaitStrategy::SPIN_WAIT}) {
+      auto queue = Shared(Queue<int>());
+      auto mutex = std::mutex();
+      auto condition = std::condition_variable();
+      auto results = std::vector<int>();
+      auto executor = Executor(
+        lift([&] (const auto& value) {
+          auto lock = std::lock_guard(mutex);
+          results.push_back(value);
+          condition.notify_all();
+        }, queue), strategy);
+      REQUIRE(executor.get_wait_strategy() == strategy);
+      auto executor_thread = std::thread([&] {
+        executor.run_until_complete();
+      });
+      auto wait_for = [&] (std::size_t count) {
+        auto lock = std::unique_lock(mutex);
+        condition.wait(lock, [&] {
+          return results.size() >= count;
+        });
+      };
+      queue->push(10);
+      wait_for(1);
+      queue->push(20);
+      wait_for(2);
+      queue->set_complete(30);
+      executor_thread.join();
+      REQUIRE(results == std::vector{10, 20, 30});
+    }
+  }
+
+  TEST_CASE("aborting_each_wait_strategy") {
+    for(auto strategy : {WaitStrategy::CONDITION_VARIABLE,
+        WaitStrategy::BUSY_SPIN, WaitStrategy::SPIN_YIELD,
+        WaitStrategy::SPIN_WAIT}) {
+      auto queue = Shared(Queue<int>());
+      auto executor = Executor(queue, strategy);
+      auto executor_thread = std::thread([&] {
+        executor.run_until_complete();
+      });
+      executor.abort();
+      executor_thread.join();
+    }
+  }
+
+  TEST_CASE("run_for") {
+    for(auto strategy : {WaitStrategy::CONDITION_VARIABLE,
+        WaitStrategy::BUSY_SPIN, WaitStrategy::SPIN_YIELD,
+        WaitStrategy::SPIN_WAIT}) {
+      auto queue = Shared(Queue<int>());
+      auto results = std::vector<int>();
+      auto executor = Executor(lift([&] (int value) {
+        results.push_back(value);
+      }, queue), strategy);
+      auto start = std::chrono::steady_clock::now();
+      REQUIRE(!executor.run_for(std::chrono::milliseconds(20)));
+      REQUIRE(std::chrono::steady_clock::now() - start >=
+        std::chrono::milliseconds(20));
+      queue->push(1);
+      queue->set_complete(2);
+      REQUIRE(executor.run_for(std::chrono::seconds(10)));
+      REQUIRE(results == std::vector{1, 2});
+      REQUIRE(executor.run_for(std::chrono::seconds(0)));
+    }
+  }
+
+  TEST_CASE("run_until_a_past_deadline") {
+    auto counter = std::make_shared<std::atomic_int>(0);
+    auto executor = Executor(
+      lift([counter] (const auto& value) {
+        ++*counter;
+      }, constant(1)));
+    REQUIRE(!executor.run_until(std::chrono::steady_clock::now()));
+    REQUIRE(counter->load() == 0);
+    REQUIRE(executor.run_until(
+      std::chrono::steady_clock::now() + std::chrono::seconds(10)));
+    REQUIRE(counter->load() == 1);
+  }
 }
@@ -0,0 +1,121 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <doctest/doctest.h>
+#include "Aspen/Box.hpp"
+#include "Aspen/Constant.hpp"
+#include "Aspen/GraphArena.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+
+using namespace Aspen;
+
+TEST_SUITE("GraphArena") {
+  TEST_CASE("allocate") {
+    auto arena = GraphArena(256);
+    REQUIRE(arena.get_size() == 0);
+    REQUIRE(arena.get_capacity() == 0);
+    auto a = arena.allocate(10, 1);
+    auto b = arena.allocate(8, 8);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(b) % 8 == 0);
+    REQUIRE(static_cast<std::byte*>(b) >= static_cast<std::byte*>(a) + 10);
+    REQUIRE(arena.get_size() == 18);
+    REQUIRE(arena.get_capacity() == 256);
+  }
+
+  TEST_CASE("growth") {
+    auto arena = GraphArena(64);
+    arena.allocate(48, 1);
+    arena.allocate(48, 1);
+    REQUIRE(arena.get_capacity() == 128);
+    auto large = arena.allocate(1000, 16);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(large) % 16 == 0);
+    REQUIRE(arena.get_capacity() >= 128 + 1000);
+  }
+
+  TEST_CASE("deallocate_last") {
+    auto arena = GraphArena();
+    auto a = arena.allocate(16, 8);
+    auto b = arena.allocate(16, 8);
+    arena.deallocate(a, 16);
+    REQUIRE(arena.get_size() == 32);
+    arena.deallocate(b, 16);
+    REQUIRE(arena.get_size() == 16);
+    REQUIRE(arena.allocate(16, 8) == b);
+  }
+
+  TEST_CASE("scope") {
+    REQUIRE(GraphArena::get_current() == nullptr);
+    auto outer = GraphArena();
+    {
+      auto outer_scope = GraphArenaScope(outer);
+      REQUIRE(GraphArena::get_current() == &outer);
+      auto inner = GraphArena();
+      {
+        auto inner_scope = GraphArenaScope(inner);
+        REQUIRE(GraphArena::get_current() == &inner);
+        {
+          auto heap_scope = GraphArenaScope(nullptr);
+          REQUIRE(GraphArena::get_current() == nullptr);
+        }
+        REQUIRE(GraphArena::get_current() == &inner);
+      }
+      REQUIRE(GraphArena::get_current() == &outer);
+    }
+    REQUIRE(GraphArena::get_current() == nullptr);
+  }
+
+  TEST_CASE("box") {
+    auto arena = GraphArena();
+    auto reactor = [&] {
+      auto scope = GraphArenaScope(arena);
+      return box(lift([padding = std::array<char, 256>()] (int value) {
+        return value + padding[0] + 1;
+      }, constant(1)));
+    }();
+    REQUIRE(arena.get_size() != 0);
+    REQUIRE(reactor.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(reactor.eval() == 2);
+    auto size = arena.get_size();
+    auto heap = box(constant(5));
+    REQUIRE(arena.get_size() == size);
+    REQUIRE(heap.commit(0) == State::COMPLETE_EVALUATED);
+    {
+      auto scope = GraphArenaScope(arena);
+      auto small = box(constant(5));
+      REQUIRE(small.is_inline());
+      REQUIRE(arena.get_size() == size);
+    }
+  }
+
+  TEST_CASE("shared") {
+    auto arena = GraphArena();
+    auto scope = GraphArenaScope(arena);
+    auto queue = Shared(Queue<int>());
+    auto size = arena.get_size();
+    REQUIRE(size != 0);
+    auto copy = queue;
+    REQUIRE(arena.get_size() == size);
+    auto reactor = shared_box(lift([] (int value) {
+      return 2 * value;
+    }, queue));
+    REQUIRE(arena.get_size() > size);
+    queue->push(5);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 10);
+    REQUIRE(copy.commit(0) == State::EVALUATED);
+    REQUIRE(copy.eval() == 5);
+  }
+
+  TEST_CASE("releasing_a_shared") {
+    auto arena = GraphArena();
+    auto scope = GraphArenaScope(arena);
+    auto size = std::size_t(0);
+    {
+      auto queue = Shared(Queue<int>());
+      size = arena.get_size();
+    }
+    REQUIRE(arena.get_size() == size);
+  }
+}
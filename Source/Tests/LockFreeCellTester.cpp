@@ -0,0 +1,103 @@
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <doctest/doctest.h>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/LockFreeCell.hpp"
+
+using namespace Aspen;
+using namespace std::string_literals;
+
+TEST_SUITE("LockFreeCell") {
+  TEST_CASE("immediate_completion") {
+    auto cell = LockFreeCell<int>();
+    cell.set_complete();
+    REQUIRE(cell.commit(0) == State::COMPLETE);
+    REQUIRE_THROWS_AS(cell.eval(), std::runtime_error);
+    REQUIRE(cell.commit(1) == State::COMPLETE);
+  }
+
+  TEST_CASE("value") {
+    auto cell = LockFreeCell(123);
+    cell.set_complete();
+    REQUIRE(cell.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(cell.eval() == 123);
+  }
+
+  TEST_CASE("value_then_completion") {
+    auto cell = LockFreeCell(321);
+    REQUIRE(cell.commit(0) == State::EVALUATED);
+    REQUIRE(cell.eval() == 321);
+    cell.set_complete();
+    REQUIRE(cell.commit(1) == State::COMPLETE);
+    REQUIRE(cell.eval() == 321);
+  }
+
+  TEST_CASE("value_while_empty") {
+    auto cell = LockFreeCell<int>();
+    REQUIRE(cell.commit(0) == State::NONE);
+    cell.set(1);
+    REQUIRE(cell.commit(1) == State::EVALUATED);
+    REQUIRE(cell.eval() == 1);
+    REQUIRE(cell.commit(2) == State::NONE);
+    REQUIRE(cell.eval() == 1);
+  }
+
+  TEST_CASE("completion_with_a_value_while_empty") {
+    auto cell = LockFreeCell<int>();
+    REQUIRE(cell.commit(0) == State::NONE);
+    cell.set_complete(1);
+    REQUIRE(cell.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE(cell.eval() == 1);
+  }
+
+  TEST_CASE("setting_repeatedly") {
+    auto cell = LockFreeCell<std::string>();
+    for(auto i = 0; i != 10; ++i) {
+      cell.set(std::to_string(2 * i));
+      cell.set(std::to_string(2 * i + 1));
+      REQUIRE(cell.commit(i) == State::EVALUATED);
+      REQUIRE(cell.eval() == std::to_string(2 * i + 1));
+    }
+  }
+
+  TEST_CASE("setting_after_completion") {
+    auto cell = LockFreeCell<int>();
+    cell.set_complete(1);
+    cell.set(2);
+    REQUIRE(cell.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(cell.eval() == 1);
+  }
+
+  TEST_CASE("move_construction") {
+    auto cell = LockFreeCell("a"s);
+    REQUIRE(cell.commit(0) == State::EVALUATED);
+    cell.set("b"s);
+    auto moved = LockFreeCell(std::move(cell));
+    REQUIRE(moved.eval() == "a"s);
+    REQUIRE(moved.commit(1) == State::EVALUATED);
+    REQUIRE(moved.eval() == "b"s);
+  }
+
+  TEST_CASE("raising_on_an_update") {
+    auto flag = CommitFlag();
+    auto cell = LockFreeCell(1);
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(cell.commit(0) == State::EVALUATED);
+    }
+    flag.clear();
+    cell.set(2);
+    REQUIRE(flag.is_raised());
+    flag.clear();
+    cell.set(3);
+    REQUIRE(!flag.is_raised());
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(cell.commit(1) == State::EVALUATED);
+      REQUIRE(cell.eval() == 3);
+    }
+    cell.set_complete();
+    REQUIRE(flag.is_raised());
+  }
+}
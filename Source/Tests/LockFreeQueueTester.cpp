@@ -0,0 +1,174 @@
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <doctest/doctest.h>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/LockFreeQueue.hpp"
+#include "Aspen/Trigger.hpp"
+
+using namespace Aspen;
+
+TEST_SUITE("LockFreeQueue") {
+  TEST_CASE("immediate_completion") {
+    auto queue = LockFreeQueue<int>();
+    queue.set_complete();
+    REQUIRE(queue.commit(0) == State::COMPLETE);
+  }
+
+  TEST_CASE("immediate_exception") {
+    auto queue = LockFreeQueue<int>();
+    queue.set_complete(std::runtime_error(""));
+    REQUIRE(queue.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("value") {
+    auto queue = LockFreeQueue<int>();
+    queue.set_complete(123);
+    REQUIRE(queue.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(queue.eval() == 123);
+  }
+
+  TEST_CASE("value_then_completion") {
+    auto queue = LockFreeQueue<int>();
+    queue.push(321);
+    REQUIRE(queue.commit(0) == State::EVALUATED);
+    REQUIRE(queue.eval() == 321);
+    queue.set_complete();
+    REQUIRE(queue.commit(1) == State::COMPLETE);
+  }
+
+  TEST_CASE("value_then_an_exception") {
+    auto queue = LockFreeQueue<int>();
+    queue.push(321);
+    REQUIRE(queue.commit(0) == State::EVALUATED);
+    REQUIRE(queue.eval() == 321);
+    queue.set_complete(std::runtime_error(""));
+    REQUIRE(queue.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("several_values") {
+    auto queue = LockFreeQueue<int>();
+    queue.push(1);
+    queue.push(2);
+    queue.push(3);
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == 1);
+    REQUIRE(queue.commit(1) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == 2);
+    REQUIRE(queue.commit(2) == State::EVALUATED);
+    REQUIRE(queue.eval() == 3);
+    REQUIRE(queue.commit(3) == State::NONE);
+    REQUIRE(queue.eval() == 3);
+  }
+
+  TEST_CASE("values_then_completion") {
+    auto queue = LockFreeQueue<int>();
+    queue.push(1);
+    queue.push(2);
+    queue.set_complete();
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == 1);
+    REQUIRE(queue.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE(queue.eval() == 2);
+  }
+
+  TEST_CASE("value_before_a_pending_exception") {
+    auto queue = LockFreeQueue<int>();
+    queue.push(1);
+    queue.set_complete(std::runtime_error("fail"));
+    REQUIRE(queue.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == 1);
+    REQUIRE(queue.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(queue.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("completing_with_a_null_exception") {
+    auto queue = LockFreeQueue<int>();
+    queue.set_complete(std::exception_ptr());
+    REQUIRE(queue.commit(0) == State::COMPLETE);
+  }
+
+  TEST_CASE("completing_with_a_convertible_value") {
+    auto queue = LockFreeQueue<std::string>();
+    queue.set_complete("done");
+    REQUIRE(queue.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(queue.eval() == "done");
+  }
+
+  TEST_CASE("move_construction") {
+    auto queue = LockFreeQueue<int>();
+    queue.push(1);
+    queue.push(2);
+    auto moved = LockFreeQueue<int>(std::move(queue));
+    REQUIRE(moved.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(moved.eval() == 1);
+    REQUIRE(moved.commit(1) == State::EVALUATED);
+    REQUIRE(moved.eval() == 2);
+    REQUIRE(queue.commit(0) == State::NONE);
+  }
+
+  TEST_CASE("raises_only_when_empty") {
+    auto queue = LockFreeQueue<int>();
+    auto flag = CommitFlag();
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(0) == State::NONE);
+    }
+    flag.clear();
+    queue.push(1);
+    REQUIRE(flag.is_raised());
+    flag.clear();
+    queue.push(2);
+    REQUIRE(!flag.is_raised());
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(1) == State::CONTINUE_EVALUATED);
+      REQUIRE(queue.commit(2) == State::EVALUATED);
+    }
+    REQUIRE(!flag.is_raised());
+    queue.push(3);
+    REQUIRE(flag.is_raised());
+  }
+
+  TEST_CASE("pushing_from_a_slot") {
+    auto queue = LockFreeQueue<int>();
+    auto flag = CommitFlag();
+    auto is_pushed = false;
+    auto trigger = Trigger([&] {
+      if(!is_pushed) {
+        is_pushed = true;
+        queue.push(2);
+      }
+    });
+    flag.set_trigger(&trigger);
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(0) == State::NONE);
+    }
+    flag.clear();
+    queue.push(1);
+    REQUIRE(is_pushed);
+    REQUIRE(queue.commit(1) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == 1);
+    REQUIRE(queue.commit(2) == State::EVALUATED);
+    REQUIRE(queue.eval() == 2);
+  }
+
+  TEST_CASE("pushing_after_completion") {
+    auto queue = LockFreeQueue<int>();
+    auto flag = CommitFlag();
+    {
+      auto scope = CommitFlagScope(flag);
+      queue.set_complete();
+      REQUIRE(queue.commit(0) == State::COMPLETE);
+    }
+    flag.clear();
+    queue.push(5);
+    queue.set_complete(6);
+    REQUIRE(!flag.is_raised());
+    REQUIRE(queue.commit(1) == State::COMPLETE);
+  }
+}
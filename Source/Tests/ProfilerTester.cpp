@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/Chain.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Constant.hpp"
+#include "Aspen/Executor.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Profiler.hpp"
+
+using namespace Aspen;
+
+#ifdef ASPEN_ENABLE_PROFILER
+namespace {
+  struct CountedEvaluation {
+    using Type = int;
+    int* m_evaluations;
+
+    State commit(std::uint64_t sequence) noexcept {
+      return State::COMPLETE_EVALUATED;
+    }
+
+    int eval() const {
+      ++*m_evaluations;
+      return 1;
+    }
+  };
+
+  const ProfileRecord* find_prefix(
+      const std::vector<ProfileRecord>& profile, const std::string& prefix) {
+    auto i = std::find_if(profile.begin(), profile.end(), [&] (auto& record) {
+      return record.m_name.starts_with(prefix);
+    });
+    if(i == profile.end()) {
+      return nullptr;
+    }
+    return &*i;
+  }
+}
+#endif
+
+TEST_SUITE("Profiler") {
+  TEST_CASE("commit") {
+    auto flag = CommitFlag();
+    auto reactor = constant(5);
+    REQUIRE(profile_commit(flag, reactor, [&] {
+      return reactor.commit(0);
+    }) == State::COMPLETE_EVALUATED);
+  }
+
+#ifdef ASPEN_ENABLE_PROFILER
+  TEST_CASE("records") {
+    reset_profile();
+    auto values = std::vector<int>();
+    auto executor = Executor(lift([&] (int left, int right) {
+      values.push_back(left + right);
+    }, constant(1), chain(2, 3)));
+    executor.run_until_complete();
+    REQUIRE(values == std::vector{3, 4});
+    auto profile = get_profile();
+    auto root = find_prefix(profile, "Aspen::Box<");
+    REQUIRE(root);
+    REQUIRE(root->m_parent == 0);
+    REQUIRE(root->m_commits == 2);
+    auto left = find_prefix(profile, "Aspen::Constant<");
+    REQUIRE(left);
+    REQUIRE(left->m_parent == root->m_id);
+    REQUIRE(left->m_commits == 1);
+    REQUIRE(left->m_evaluations == 1);
+    auto right = find_prefix(profile, "Aspen::Chain<");
+    REQUIRE(right);
+    REQUIRE(right->m_parent == root->m_id);
+    REQUIRE(right->m_commits == 2);
+    REQUIRE(right->m_evaluations == 2);
+    REQUIRE(root->m_total_time >= left->m_total_time + right->m_total_time);
+    REQUIRE(root->m_max_time <= root->m_total_time);
+    reset_profile();
+    REQUIRE(get_profile().empty());
+  }
+
+  TEST_CASE("exceptions") {
+    reset_profile();
+    auto failing = [] (int value) -> int {
+      throw std::runtime_error("fail");
+    };
+    auto executor = Executor(lift([] (int value) {},
+      lift(failing, lift(failing, constant(1)))));
+    executor.run_until_complete();
+    auto profile = get_profile();
+    auto failures = std::count_if(profile.begin(), profile.end(),
+      [] (auto& record) {
+        return record.m_exceptions != 0;
+      });
+    REQUIRE(failures == 2);
+  }
+
+  TEST_CASE("no_extra_evaluations") {
+    reset_profile();
+    auto evaluations = 0;
+    auto executor = Executor(lift([] (int value) {},
+      CountedEvaluation(&evaluations)));
+    executor.run_until_complete();
+    REQUIRE(evaluations == 1);
+  }
+
+  TEST_CASE("reused_flag_addresses") {
+    reset_profile();
+    for(auto i = 0; i != 2; ++i) {
+      auto flag = CommitFlag();
+      auto reactor = constant(i);
+      profile_commit(flag, reactor, [&] {
+        return reactor.commit(0);
+      });
+    }
+    auto profile = get_profile();
+    REQUIRE(profile.size() == 2);
+    REQUIRE(profile[0].m_id != profile[1].m_id);
+    REQUIRE(profile[0].m_commits == 1);
+    REQUIRE(profile[1].m_commits == 1);
+  }
+
+  TEST_CASE("print") {
+    reset_profile();
+    auto executor = Executor(lift([] (int value) {}, constant(1)));
+    executor.run_until_complete();
+    auto flat = std::stringstream();
+    print_profile(flat, ProfileLayout::FLAT);
+    REQUIRE(flat.str().find("Constant") != std::string::npos);
+    auto hierarchical = std::stringstream();
+    print_profile(hierarchical, ProfileLayout::HIERARCHICAL);
+    REQUIRE(hierarchical.str().find("  Aspen::Constant") != std::string::npos);
+  }
+#else
+  TEST_CASE("disabled") {
+    auto executor = Executor(constant(1));
+    executor.run_until_complete();
+    REQUIRE(get_profile().empty());
+    auto sink = std::stringstream();
+    print_profile(sink, ProfileLayout::FLAT);
+    REQUIRE(sink.str().empty());
+  }
+#endif
+}
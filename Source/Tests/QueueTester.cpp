@@ -2,6 +2,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 #include <doctest/doctest.h>
 #include "Aspen/CommitFlag.hpp"
 #include "Aspen/Queue.hpp"
@@ -9,6 +10,19 @@
 
 using namespace Aspen;
 
+namespace {
+  struct Unconvertible {
+    int m_value;
+
+    Unconvertible(int value)
+        : m_value(value) {
+      if(value < 0) {
+        throw std::invalid_argument("Negative value.");
+      }
+    }
+  };
+}
+
 TEST_SUITE("Queue") {
   TEST_CASE("immediate_completion") {
     auto queue = Queue<int>();
@@ -94,6 +108,64 @@ TEST_SUITE("Queue") {
     REQUIRE(queue.commit(3) == State::NONE);
   }
 
+  TEST_CASE("pushing_many_values") {
+    auto queue = Queue<double>();
+    auto flag = CommitFlag();
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(0) == State::NONE);
+    }
+    flag.clear();
+    auto values = std::vector{1, 2, 3};
+    queue.push_many(values);
+    REQUIRE(flag.is_raised());
+    REQUIRE(queue.commit(1) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == 1);
+    REQUIRE(queue.commit(2) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval() == 2);
+    REQUIRE(queue.commit(3) == State::EVALUATED);
+    REQUIRE(queue.eval() == 3);
+    queue.set_complete();
+    queue.push_many(values);
+    REQUIRE(queue.commit(4) == State::COMPLETE);
+  }
+
+  TEST_CASE("pushing_an_empty_range") {
+    auto queue = Queue<int>();
+    auto flag = CommitFlag();
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(0) == State::NONE);
+    }
+    flag.clear();
+    queue.push_many(std::vector<int>());
+    REQUIRE(!flag.is_raised());
+    REQUIRE(queue.commit(1) == State::NONE);
+  }
+
+  TEST_CASE("pushing_many_values_throwing_mid_range") {
+    auto queue = Queue<Unconvertible>();
+    auto flag = CommitFlag();
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(0) == State::NONE);
+    }
+    flag.clear();
+    auto values = std::vector{1, -1, 2};
+    REQUIRE_THROWS_AS(queue.push_many(values), std::invalid_argument);
+    REQUIRE(!flag.is_raised());
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(queue.commit(1) == State::NONE);
+    }
+    queue.push_many(std::vector{3, 4});
+    REQUIRE(flag.is_raised());
+    REQUIRE(queue.commit(2) == State::CONTINUE_EVALUATED);
+    REQUIRE(queue.eval().m_value == 3);
+    REQUIRE(queue.commit(3) == State::EVALUATED);
+    REQUIRE(queue.eval().m_value == 4);
+  }
+
   TEST_CASE("move_construction") {
     auto queue = Queue<int>();
     queue.push(1);
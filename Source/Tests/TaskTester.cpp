@@ -0,0 +1,131 @@
+#include <stdexcept>
+#include <utility>
+#include <doctest/doctest.h>
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Constant.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+#include "Aspen/Task.hpp"
+
+using namespace Aspen;
+
+namespace {
+  Task<int> make_constant(int value) {
+    co_return value;
+  }
+
+  Task<int> make_series() {
+    co_yield 1;
+    co_yield 2;
+    co_return 3;
+  }
+
+  Task<void> make_empty() {
+    co_return;
+  }
+
+  Task<int> make_failure() {
+    co_yield 1;
+    throw std::runtime_error("fail");
+  }
+
+  Task<int> make_sum(Shared<Queue<int>> queue) {
+    auto sum = 0;
+    while(true) {
+      auto value = co_await queue;
+      if(value == 0) {
+        co_return sum;
+      }
+      sum += value;
+      co_yield sum;
+    }
+  }
+}
+
+TEST_SUITE("Task") {
+  TEST_CASE("constant") {
+    auto task = make_constant(5);
+    REQUIRE(task.commit(0) == State::COMPLETE_EVALUATED);
+    REQUIRE(task.eval() == 5);
+    REQUIRE(task.commit(1) == State::COMPLETE);
+  }
+
+  TEST_CASE("void") {
+    auto task = make_empty();
+    REQUIRE(task.commit(0) == State::COMPLETE);
+    REQUIRE_NOTHROW(task.eval());
+  }
+
+  TEST_CASE("yield") {
+    auto task = make_series();
+    REQUIRE(task.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(task.eval() == 1);
+    REQUIRE(task.commit(1) == State::CONTINUE_EVALUATED);
+    REQUIRE(task.eval() == 2);
+    REQUIRE(task.commit(2) == State::COMPLETE_EVALUATED);
+    REQUIRE(task.eval() == 3);
+  }
+
+  TEST_CASE("exception") {
+    auto task = make_failure();
+    REQUIRE(task.commit(0) == State::CONTINUE_EVALUATED);
+    REQUIRE(task.eval() == 1);
+    REQUIRE(task.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE_THROWS_AS(task.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("uninitialized") {
+    auto task = make_sum(Shared(Queue<int>()));
+    REQUIRE_THROWS_AS(task.eval(), std::runtime_error);
+  }
+
+  TEST_CASE("await_reactor") {
+    auto queue = Shared(Queue<int>());
+    auto task = make_sum(queue);
+    auto flag = CommitFlag();
+    auto commit = [&] (std::uint64_t sequence) {
+      flag.clear();
+      auto scope = CommitFlagScope(flag);
+      return task.commit(sequence);
+    };
+    REQUIRE(commit(0) == State::CONTINUE);
+    REQUIRE(commit(1) == State::NONE);
+    REQUIRE(!flag.is_raised());
+    queue->push(3);
+    REQUIRE(flag.is_raised());
+    REQUIRE(commit(2) == State::CONTINUE_EVALUATED);
+    REQUIRE(task.eval() == 3);
+    REQUIRE(commit(3) == State::CONTINUE);
+    queue->push(4);
+    REQUIRE(commit(4) == State::CONTINUE_EVALUATED);
+    REQUIRE(task.eval() == 7);
+    queue->push(0);
+    REQUIRE(commit(5) == State::CONTINUE);
+    REQUIRE(commit(6) == State::COMPLETE_EVALUATED);
+    REQUIRE(task.eval() == 7);
+  }
+
+  TEST_CASE("await_task") {
+    auto task = [] () -> Task<int> {
+      auto left = co_await make_constant(2);
+      auto right = co_await constant(3);
+      co_return left * right;
+    }();
+    REQUIRE(task.commit(0) == State::CONTINUE);
+    REQUIRE(task.commit(1) == State::CONTINUE);
+    REQUIRE(task.commit(2) == State::COMPLETE_EVALUATED);
+    REQUIRE(task.eval() == 6);
+  }
+
+  TEST_CASE("move") {
+    auto task = make_series();
+    REQUIRE(task.commit(0) == State::CONTINUE_EVALUATED);
+    auto moved = std::move(task);
+    REQUIRE(moved.eval() == 1);
+    REQUIRE(moved.commit(1) == State::CONTINUE_EVALUATED);
+    REQUIRE(moved.eval() == 2);
+    moved = make_constant(9);
+    REQUIRE(moved.commit(2) == State::COMPLETE_EVALUATED);
+    REQUIRE(moved.eval() == 9);
+  }
+}
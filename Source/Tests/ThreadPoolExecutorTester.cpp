@@ -0,0 +1,145 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <doctest/doctest.h>
+#include "Aspen/Chain.hpp"
+#include "Aspen/Constant.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Queue.hpp"
+#include "Aspen/Shared.hpp"
+#include "Aspen/ThreadPoolExecutor.hpp"
+
+using namespace Aspen;
+
+namespace {
+  template<IsReactor R>
+  struct Tally {
+    using Type = reactor_result_t<R>;
+    static constexpr auto is_noexcept = is_noexcept_reactor_v<R>;
+    R m_reactor;
+    std::shared_ptr<std::atomic_int> m_commits;
+
+    Tally(R reactor, std::shared_ptr<std::atomic_int> commits)
+      : m_reactor(std::move(reactor)),
+        m_commits(std::move(commits)) {}
+
+    State commit(std::uint64_t sequence) noexcept {
+      m_commits->fetch_add(1);
+      return m_reactor.commit(sequence);
+    }
+
+    decltype(auto) eval() const noexcept(is_noexcept) {
+      return m_reactor.eval();
+    }
+  };
+}
+
+TEST_SUITE("ThreadPoolExecutor") {
+  TEST_CASE("thread_count") {
+    auto executor = ThreadPoolExecutor(3);
+    REQUIRE(executor.get_thread_count() == 3);
+    auto empty = ThreadPoolExecutor(0);
+    REQUIRE(empty.get_thread_count() == 1);
+  }
+
+  TEST_CASE("wait_without_reactors") {
+    auto executor = ThreadPoolExecutor(2);
+    executor.wait();
+  }
+
+  TEST_CASE("constant") {
+    auto executor = ThreadPoolExecutor(2);
+    auto result = std::make_shared<std::atomic_int>(0);
+    executor.add(lift([=] (int value) {
+      result->store(value);
+    }, constant(5)));
+    executor.wait();
+    REQUIRE(result->load() == 5);
+  }
+
+  TEST_CASE("continuation") {
+    auto executor = ThreadPoolExecutor(2);
+    auto mutex = std::mutex();
+    auto results = std::vector<int>();
+    executor.add(lift([&] (int value) {
+      auto lock = std::lock_guard(mutex);
+      results.push_back(value);
+    }, chain(1, 2, 3)));
+    executor.wait();
+    REQUIRE(results == std::vector{1, 2, 3});
+  }
+
+  TEST_CASE("many_reactors") {
+    const auto COUNT = 1000;
+    auto executor = ThreadPoolExecutor(4);
+    auto sum = std::make_shared<std::atomic_int>(0);
+    for(auto i = 0; i != COUNT; ++i) {
+      executor.add(lift([=] (int value) {
+        sum->fetch_add(value);
+      }, chain(i, 1)));
+    }
+    executor.wait();
+    REQUIRE(sum->load() == COUNT * (COUNT - 1) / 2 + COUNT);
+  }
+
+  TEST_CASE("commits_only_on_update") {
+    auto executor = ThreadPoolExecutor(2);
+    auto queue = Shared(Queue<int>());
+    auto commits = std::make_shared<std::atomic_int>(0);
+    auto mutex = std::mutex();
+    auto results = std::vector<int>();
+    executor.add(Tally(lift([&] (int value) {
+      auto lock = std::lock_guard(mutex);
+      results.push_back(value);
+    }, queue), commits));
+    queue->push(10);
+    queue->push(20);
+    queue->set_complete(30);
+    executor.wait();
+    REQUIRE(results == std::vector{10, 20, 30});
+    REQUIRE(commits->load() <= 5);
+  }
+
+  TEST_CASE("independent_queues") {
+    const auto COUNT = std::size_t(64);
+    const auto PUSHES = 100;
+    auto executor = ThreadPoolExecutor(4);
+    auto queues = std::vector<Shared<Queue<int>>>();
+    auto sums = std::vector<std::shared_ptr<std::atomic_int>>();
+    for(auto i = std::size_t(0); i != COUNT; ++i) {
+      queues.push_back(Shared(Queue<int>()));
+      sums.push_back(std::make_shared<std::atomic_int>(0));
+      executor.add(lift([sum = sums.back()] (int value) {
+        sum->fetch_add(value);
+      }, queues.back()));
+    }
+    for(auto value = 1; value <= PUSHES; ++value) {
+      for(auto& queue : queues) {
+        queue->push(value);
+      }
+    }
+    for(auto& queue : queues) {
+      queue->set_complete();
+    }
+    executor.wait();
+    for(auto& sum : sums) {
+      REQUIRE(sum->load() == PUSHES * (PUSHES + 1) / 2);
+    }
+  }
+
+  TEST_CASE("aborting") {
+    auto executor = ThreadPoolExecutor(2);
+    auto queue = Shared(Queue<int>());
+    auto result = std::make_shared<std::atomic_int>(0);
+    executor.add(lift([=] (int value) {
+      result->store(value);
+    }, queue));
+    queue->push(1);
+    executor.abort();
+    executor.wait();
+    queue->push(2);
+  }
+}
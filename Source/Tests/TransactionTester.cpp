@@ -0,0 +1,124 @@
+#include <doctest/doctest.h>
+#include "Aspen/Cell.hpp"
+#include "Aspen/CommitFlag.hpp"
+#include "Aspen/Lift.hpp"
+#include "Aspen/Shared.hpp"
+#include "Aspen/Transaction.hpp"
+
+using namespace Aspen;
+
+TEST_SUITE("Transaction") {
+  TEST_CASE("staging") {
+    auto flag = CommitFlag();
+    auto cell = Cell(1);
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(cell.commit(0) == State::EVALUATED);
+    }
+    flag.clear();
+    auto transaction = Transaction();
+    REQUIRE(Transaction::get_current() == &transaction);
+    cell.set(2);
+    REQUIRE(!flag.is_raised());
+    {
+      auto scope = CommitFlagScope(flag);
+      REQUIRE(cell.commit(1) == State::NONE);
+    }
+    REQUIRE(cell.eval() == 1);
+    transaction.commit();
+    REQUIRE(flag.is_raised());
+    REQUIRE(cell.commit(2) == State::EVALUATED);
+    REQUIRE(cell.eval() == 2);
+  }
+
+  TEST_CASE("several_cells") {
+    auto left = Shared(Cell(1));
+    auto right = Shared(Cell(2));
+    auto evaluations = 0;
+    auto reactor = lift([&] (int a, int b) {
+      ++evaluations;
+      return a + b;
+    }, left, right);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE(evaluations == 1);
+    {
+      auto transaction = Transaction();
+      left->set(10);
+      right->set(20);
+      REQUIRE(reactor.commit(1) == State::NONE);
+      transaction.commit();
+    }
+    REQUIRE(reactor.commit(2) == State::EVALUATED);
+    REQUIRE(reactor.eval() == 30);
+    REQUIRE(evaluations == 2);
+  }
+
+  TEST_CASE("discarding") {
+    auto cell = Cell(1);
+    REQUIRE(cell.commit(0) == State::EVALUATED);
+    {
+      auto transaction = Transaction();
+      cell.set(2);
+      cell.set_complete();
+    }
+    REQUIRE(Transaction::get_current() == nullptr);
+    REQUIRE(cell.commit(1) == State::NONE);
+    cell.set(3);
+    REQUIRE(cell.commit(2) == State::EVALUATED);
+    REQUIRE(cell.eval() == 3);
+  }
+
+  TEST_CASE("completion") {
+    auto cell = Cell<int>();
+    auto transaction = Transaction();
+    cell.set_complete(5);
+    REQUIRE(cell.commit(0) == State::NONE);
+    transaction.commit();
+    REQUIRE(cell.commit(1) == State::COMPLETE_EVALUATED);
+    REQUIRE(cell.eval() == 5);
+  }
+
+  TEST_CASE("nesting") {
+    auto outer = Transaction();
+    {
+      auto inner = Transaction();
+      REQUIRE(Transaction::get_current() == &inner);
+    }
+    REQUIRE(Transaction::get_current() == &outer);
+  }
+
+  TEST_CASE("snapshot") {
+    auto cell = Cell(1);
+    REQUIRE(cell.commit(0) == State::EVALUATED);
+    auto transaction = Transaction();
+    cell.set(2);
+    {
+      auto snapshot = TransactionSnapshot();
+      auto version = Transaction::get_visible_version();
+      transaction.commit();
+      REQUIRE(Transaction::get_visible_version() == version);
+      REQUIRE(cell.commit(1) == State::CONTINUE);
+      REQUIRE(cell.eval() == 1);
+    }
+    REQUIRE(cell.commit(2) == State::EVALUATED);
+    REQUIRE(cell.eval() == 2);
+  }
+
+  TEST_CASE("setting_over_a_staged_value") {
+    auto cell = Cell(1);
+    REQUIRE(cell.commit(0) == State::EVALUATED);
+    {
+      auto snapshot = TransactionSnapshot();
+      {
+        auto transaction = Transaction();
+        cell.set(2);
+        transaction.commit();
+      }
+      cell.set(3);
+      REQUIRE(cell.commit(1) == State::CONTINUE);
+      REQUIRE(cell.eval() == 1);
+    }
+    REQUIRE(cell.commit(2) == State::EVALUATED);
+    REQUIRE(cell.eval() == 3);
+  }
+}
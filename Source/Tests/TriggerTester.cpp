@@ -1,3 +1,4 @@
+#include <memory>
 #include <thread>
 #include <doctest/doctest.h>
 #include "Aspen/Trigger.hpp"
@@ -16,6 +17,19 @@ TEST_SUITE("Trigger") {
     REQUIRE(count == 2);
   }
 
+  TEST_CASE("destroying_the_slot") {
+    auto count = std::make_shared<int>(0);
+    {
+      auto trigger = Trigger([count] {
+        ++*count;
+      });
+      REQUIRE(count.use_count() == 2);
+      trigger.signal();
+    }
+    REQUIRE(count.use_count() == 1);
+    REQUIRE(*count == 1);
+  }
+
   TEST_CASE("signalling_a_default_trigger") {
     auto count = 0;
     auto trigger = Trigger();
@@ -4,6 +4,7 @@
 #include "Aspen/Box.hpp"
 #include "Aspen/Cell.hpp"
 #include "Aspen/Chain.hpp"
+#include "Aspen/CommitPool.hpp"
 #include "Aspen/Constant.hpp"
 #include "Aspen/None.hpp"
 #include "Aspen/Queue.hpp"
@@ -160,4 +161,22 @@ TEST_SUITE("VectorSync") {
     REQUIRE(reactor.get_exception(1) != nullptr);
     REQUIRE(reactor.get_exception() == reactor.get_exception(1));
   }
+
+  TEST_CASE("parallel_commit") {
+    auto pool = CommitPool(2);
+    auto list = std::vector<int>();
+    auto cells = std::vector<Shared<Cell<int>>>();
+    auto reactors = std::vector<Box<int>>();
+    for(auto i = 0; i != 10; ++i) {
+      cells.push_back(Shared(Cell(i)));
+      reactors.push_back(box(cells.back()));
+    }
+    auto reactor = VectorSync(list, std::move(reactors), pool);
+    REQUIRE(reactor.commit(0) == State::EVALUATED);
+    REQUIRE(list == std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    cells[2]->set(20);
+    cells[7]->set(70);
+    REQUIRE(reactor.commit(1) == State::EVALUATED);
+    REQUIRE(reactor.eval() == std::vector{0, 1, 20, 3, 4, 5, 6, 70, 8, 9});
+  }
 }
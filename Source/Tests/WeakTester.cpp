@@ -1,3 +1,4 @@
+#include <memory>
 #include <optional>
 #include <utility>
 #include <doctest/doctest.h>
@@ -69,6 +70,20 @@ TEST_SUITE("Weak") {
     REQUIRE(!weak.lock());
   }
 
+  TEST_CASE("releasing_the_reactor") {
+    auto value = std::make_shared<int>(5);
+    auto shared = std::optional(Shared(Cell(value)));
+    auto weak = Weak(*shared);
+    auto copy = std::optional(*shared);
+    REQUIRE(value.use_count() == 2);
+    shared = std::nullopt;
+    REQUIRE(value.use_count() == 2);
+    copy = std::nullopt;
+    REQUIRE(value.use_count() == 1);
+    REQUIRE(!weak.lock());
+    REQUIRE(weak.commit(0) == State::COMPLETE);
+  }
+
   TEST_CASE("copy_and_move_construction") {
     auto shared = std::optional(Shared(Queue<int>()));
     auto weak = Weak(*shared);